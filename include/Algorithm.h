@@ -53,6 +53,10 @@ public:
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
 
   std::vector<Kernel*> activeKernels_;
+
+  // loops are restricted to realm_.assembly_phase_selector(), so that a
+  // driver may run the interface and interior entities separately
+  bool overlapsParallelSum_{false};
 };
 
 } // namespace nalu
@@ -13,6 +13,7 @@
 
 #include "SolverAlgorithm.h"
 #include "ElemDataRequests.h"
+#include "EntityColoring.h"
 #include "ElemDataRequestsGPU.h"
 #include "Realm.h"
 #include "ScratchViews.h"
@@ -56,20 +57,49 @@ public:
     const int bytes_per_team = 0;
     const int bytes_per_thread = calc_shmem_bytes_per_thread_edge(rhsSize_);
 
-    stk::mesh::Selector sel = meta.locally_owned_part() &
-                              stk::mesh::selectUnion(partVec_) &
-                              !(realm_.get_inactive_selector());
-
-    const auto& buckets = ngp::get_bucket_ids(bulk, entityRank_, sel);
-    auto team_exec = get_device_team_policy(buckets.size(), bytes_per_team, bytes_per_thread);
-
     // Create local copies of class data for device capture
     const auto entityRank = entityRank_;
     const auto rhsSize = rhsSize_;
 
     auto coeffApplier = coeff_applier();
 
-    const auto nodesPerEntity = nodesPerEntity_;
+    if (realm_.coloredAssembly_) {
+      // edges of one color share no nodes and sum into their rows with
+      // plain stores; the colors are processed one after the other
+      const auto& coloring = realm_.entity_coloring(entityRank_, partVec_);
+      set_atomic_free_assembly(true);
+      for (int c = 0; c < coloring.num_colors(); ++c) {
+        const auto edges = coloring.color_entities(c);
+        const size_t numEdges = edges.extent(0);
+        auto team_exec = get_device_team_policy(
+          coloring.num_chunks(c), bytes_per_team, bytes_per_thread);
+
+        Kokkos::parallel_for(
+          team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
+            ShmemDataType smdata(team, rhsSize);
+
+            const size_t begin = team.league_rank() * EntityColoring::chunkSize;
+            const size_t end = (begin + EntityColoring::chunkSize < numEdges)
+              ? begin + EntityColoring::chunkSize : numEdges;
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, begin, end),
+              [&](const size_t& k) {
+                const auto& b = ngpMesh.get_bucket(entityRank, edges(k).bucket_id);
+                assemble_edge(
+                  ngpMesh, coeffApplier, smdata, b[edges(k).bucket_ord], lambdaFunc);
+              });
+          });
+      }
+      set_atomic_free_assembly(false);
+      return;
+    }
+
+    stk::mesh::Selector sel = meta.locally_owned_part() &
+                              stk::mesh::selectUnion(partVec_) &
+                              !(realm_.get_inactive_selector());
+
+    const auto& buckets = ngp::get_bucket_ids(bulk, entityRank_, sel);
+    auto team_exec = get_device_team_policy(buckets.size(), bytes_per_team, bytes_per_thread);
 
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
@@ -82,21 +112,7 @@ public:
         Kokkos::parallel_for(
           Kokkos::TeamThreadRange(team, bktLen),
           [&](const size_t& bktIndex) {
-            auto edge = b[bktIndex];
-            const auto edgeIndex = ngpMesh.fast_mesh_index(edge);
-            smdata.ngpElemNodes = ngpMesh.get_nodes(entityRank, edgeIndex);
-
-            const auto nodeL = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[0]);
-            const auto nodeR = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[1]);
-
-            set_zero(smdata.rhs.data(), smdata.rhs.size());
-            set_zero(smdata.lhs.data(), smdata.lhs.size());
-
-            lambdaFunc(smdata, edgeIndex, nodeL, nodeR);
-
-            coeffApplier(
-              nodesPerEntity, smdata.ngpElemNodes, smdata.scratchIds,
-              smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
+            assemble_edge(ngpMesh, coeffApplier, smdata, b[bktIndex], lambdaFunc);
           });
       });
   }
@@ -108,6 +124,33 @@ protected:
   static constexpr int nodesPerEntity_{2};
   static constexpr int NDimMax_{3};
   const int rhsSize_;
+
+private:
+  //! Compute the contributions of one edge and sum them into the system
+  template<typename LambdaFunction>
+  KOKKOS_INLINE_FUNCTION
+  static void assemble_edge(
+    const ngp::Mesh& ngpMesh,
+    const NGPApplyCoeff& coeffApplier,
+    ShmemDataType& smdata,
+    const stk::mesh::Entity edge,
+    const LambdaFunction& lambdaFunc)
+  {
+    const auto edgeIndex = ngpMesh.fast_mesh_index(edge);
+    smdata.ngpElemNodes = ngpMesh.get_nodes(stk::topology::EDGE_RANK, edgeIndex);
+
+    const auto nodeL = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[0]);
+    const auto nodeR = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[1]);
+
+    set_zero(smdata.rhs.data(), smdata.rhs.size());
+    set_zero(smdata.lhs.data(), smdata.lhs.size());
+
+    lambdaFunc(smdata, edgeIndex, nodeL, nodeR);
+
+    coeffApplier.sum_into_edge(
+      edge, smdata.ngpElemNodes, smdata.scratchIds,
+      smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
+  }
 };
 
 }  // nalu
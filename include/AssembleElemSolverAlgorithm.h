@@ -14,6 +14,7 @@
 
 #include<Realm.h>
 #include<SolverAlgorithm.h>
+#include <EntityColoring.h>
 #include <KokkosInterface.h>
 #include <SimdInterface.h>
 #include<ScratchViews.h>
@@ -67,6 +68,54 @@ public:
       lhsSize, rhsSize_, scratchIdsSize, meta_data.spatial_dimension(),
       dataNeededNGP, reqType);
 
+    // Create local copies of class data
+    const auto entityRank = entityRank_;
+    const auto nodesPerEntity = nodesPerEntity_;
+    const auto rhsSize = rhsSize_;
+
+    if (realm_.coloredAssembly_) {
+      // elements of one color share no nodes and sum into their rows with
+      // plain stores; the colors are processed one after the other
+      const auto& coloring = realm_.entity_coloring(entityRank_, partVec_);
+      set_atomic_free_assembly(true);
+      for (int c = 0; c < coloring.num_colors(); ++c) {
+        const auto elems = coloring.color_entities(c);
+        const size_t numElems = elems.extent(0);
+        auto team_exec = sierra::nalu::get_device_team_policy(
+          coloring.num_chunks(c), bytes_per_team, bytes_per_thread);
+
+        Kokkos::parallel_for(
+          team_exec, KOKKOS_LAMBDA(const sierra::nalu::DeviceTeamHandleType& team) {
+            SharedMemData<DeviceTeamHandleType, DeviceShmem> smdata(
+              team, nDim, dataNeededNGP, nodesPerEntity, rhsSize);
+
+            const size_t begin = team.league_rank() * EntityColoring::chunkSize;
+            const size_t chunkLen = (begin + EntityColoring::chunkSize < numElems)
+              ? EntityColoring::chunkSize : numElems - begin;
+            const size_t simdChunkLen = get_num_simd_groups(chunkLen);
+
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, simdChunkLen), [&](const size_t& simdIndex) {
+                const int numSimdElems =
+                  get_length_of_next_simd_group(simdIndex, chunkLen);
+
+                stk::mesh::Entity simdElems[simdLen];
+                for (int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex) {
+                  const auto& idx = elems(begin + simdIndex * simdLen + simdElemIndex);
+                  simdElems[simdElemIndex] =
+                    ngpMesh.get_bucket(entityRank, idx.bucket_id)[idx.bucket_ord];
+                }
+
+                execute_simd_group(
+                  ngpMesh, dataNeededNGP, entityRank, smdata,
+                  simdElems, numSimdElems, lambdaFunc);
+              });
+          });
+      }
+      set_atomic_free_assembly(false);
+      return;
+    }
+
     stk::mesh::Selector elemSelector = meta_data.locally_owned_part() &
                                        stk::mesh::selectUnion(partVec_) &
                                        !realm_.get_inactive_selector();
@@ -74,11 +123,6 @@ public:
     const auto& elem_buckets =
       ngp::get_bucket_ids(bulk_data, entityRank_, elemSelector);
 
-    // Create local copies of class data
-    const auto entityRank = entityRank_;
-    const auto nodesPerEntity = nodesPerEntity_;
-    const auto rhsSize = rhsSize_;
-
     auto team_exec = sierra::nalu::get_device_team_policy(
       elem_buckets.size(), bytes_per_team, bytes_per_thread);
     Kokkos::parallel_for(
@@ -102,32 +146,54 @@ public:
 
         Kokkos::parallel_for(
           Kokkos::TeamThreadRange(team, simdBucketLen), [&](const size_t& bktIndex) {
-            int numSimdElems =
+            const int numSimdElems =
               get_length_of_next_simd_group(bktIndex, bucketLen);
-            smdata.numSimdElems = numSimdElems;
-
-            for (int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex) {
-              stk::mesh::Entity element = b[bktIndex * simdLen + simdElemIndex];
-              const auto elemIndex = ngpMesh.fast_mesh_index(element);
-              smdata.ngpElemNodes[simdElemIndex] =
-                ngpMesh.get_nodes(entityRank, elemIndex);
-              fill_pre_req_data(
-                dataNeededNGP, ngpMesh, entityRank, element,
-                *smdata.prereqData[simdElemIndex]);
-            }
 
-#ifndef KOKKOS_ENABLE_CUDA
-            // No need to interleave on GPUs
-            copy_and_interleave(
-              smdata.prereqData, numSimdElems, smdata.simdPrereqData);
-#endif
+            stk::mesh::Entity simdElems[simdLen];
+            for (int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex)
+              simdElems[simdElemIndex] = b[bktIndex * simdLen + simdElemIndex];
 
-            fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
-            lambdaFunc(smdata);
+            execute_simd_group(
+              ngpMesh, dataNeededNGP, entityRank, smdata,
+              simdElems, numSimdElems, lambdaFunc);
           });
       });
   }
 
+  //! Gather the data of one SIMD group of elements and execute the kernels
+  template<typename LambdaFunction>
+  KOKKOS_INLINE_FUNCTION
+  static void execute_simd_group(
+    const ngp::Mesh& ngpMesh,
+    const ElemDataRequestsGPU& dataNeededNGP,
+    const stk::mesh::EntityRank entityRank,
+    SharedMemData<DeviceTeamHandleType, DeviceShmem>& smdata,
+    const stk::mesh::Entity* simdElems,
+    const int numSimdElems,
+    const LambdaFunction& lambdaFunc)
+  {
+    smdata.numSimdElems = numSimdElems;
+
+    for (int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex) {
+      stk::mesh::Entity element = simdElems[simdElemIndex];
+      const auto elemIndex = ngpMesh.fast_mesh_index(element);
+      smdata.ngpElemNodes[simdElemIndex] =
+        ngpMesh.get_nodes(entityRank, elemIndex);
+      fill_pre_req_data(
+        dataNeededNGP, ngpMesh, entityRank, element,
+        *smdata.prereqData[simdElemIndex]);
+    }
+
+#ifndef KOKKOS_ENABLE_CUDA
+    // No need to interleave on GPUs
+    copy_and_interleave(
+      smdata.prereqData, numSimdElems, smdata.simdPrereqData);
+#endif
+
+    fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+    lambdaFunc(smdata);
+  }
+
   ElemDataRequests dataNeededByKernels_;
   stk::mesh::EntityRank entityRank_;
 
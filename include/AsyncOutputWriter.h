@@ -0,0 +1,196 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef AsyncOutputWriter_h
+#define AsyncOutputWriter_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_util/util/ParameterList.hpp>
+
+#include <mpi.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Ioss {
+class GroupingEntity;
+class Region;
+}
+
+namespace stk {
+namespace io {
+class StkMeshIoBroker;
+}
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Background writer for results and restart databases
+ *
+ *  The writer owns an io broker on a duplicate of the mesh communicator;
+ *  the asynchronous databases are created and defined through it, so the
+ *  collectives of the io libraries on the writer thread never interleave
+ *  with those of the solver on the mesh communicator.
+ *
+ *  A write request gathers the fields of a database on the calling thread,
+ *  in the entity order of each Ioss block of the database, and queues the
+ *  buffers; the writer thread hands them to Ioss while the solver proceeds
+ *  with the next time step. The writer thread does not access the mesh,
+ *  the fields or the io broker. At most maxInFlight snapshots are held at
+ *  any time; submit() blocks when that bound is reached.
+ *
+ *  The first step of each database defines the output mesh through the io
+ *  broker, so it is written synchronously on the calling thread. Only node
+ *  and element fields are supported. Library calls hold
+ *  library_io_mutex(), as must any other Ioss or HDF5 io while the writer
+ *  exists.
+ */
+class AsyncOutputWriter
+{
+public:
+  AsyncOutputWriter(
+    stk::mesh::BulkData& bulk,
+    const int maxInFlight);
+
+  ~AsyncOutputWriter();
+
+  //! True if the field can be written through the writer
+  static bool supports_field(const stk::mesh::FieldBase& field);
+
+  //! Io broker on which the asynchronous databases are created
+  stk::io::StkMeshIoBroker& io_broker() { return *ioBroker_; }
+
+  //! Add a field to a database created on io_broker()
+  void add_field(
+    const size_t fileIndex,
+    stk::mesh::FieldBase& field,
+    const std::string& dbName);
+
+  //! Gather the fields of a database and queue the write of one step
+  void submit(
+    const size_t fileIndex,
+    const double time,
+    const std::vector<std::pair<std::string, stk::util::Parameter> >& globals);
+
+  //! Block until every queued write has completed
+  void wait();
+
+  //! Time the calling thread spent gathering snapshots and waiting for slots
+  double stallTime_{0.0};
+
+private:
+  AsyncOutputWriter(const AsyncOutputWriter&) = delete;
+  AsyncOutputWriter& operator=(const AsyncOutputWriter&) = delete;
+
+  //! A field of a database and the name it is written under
+  struct OutputField
+  {
+    stk::mesh::FieldBase* field{nullptr};
+    std::string dbName;
+  };
+
+  //! A field (state) as stored on one Ioss block
+  struct BlockField
+  {
+    const stk::mesh::FieldBase* field{nullptr};
+    std::string dbName;
+    size_t entityBytes{0};
+  };
+
+  //! Entities of one Ioss block in database order; rebuilt when the mesh changes
+  struct OutputBlock
+  {
+    Ioss::GroupingEntity* ioEntity{nullptr};
+    std::vector<stk::mesh::Entity> entities;
+    std::vector<BlockField> fields;
+  };
+
+  //! Field data of one Ioss block, in the layout Ioss expects
+  struct BlockData
+  {
+    Ioss::GroupingEntity* ioEntity{nullptr};
+    std::string dbName;
+    std::vector<unsigned char> data;
+  };
+
+  //! Global values; only one of the vectors is used
+  struct GlobalData
+  {
+    std::string name;
+    std::vector<double> realData;
+    std::vector<int> intData;
+    std::vector<int64_t> int64Data;
+  };
+
+  struct Snapshot
+  {
+    Ioss::Region* region{nullptr};
+    double time{0.0};
+    std::vector<BlockData> blocks;
+    std::vector<GlobalData> globals;
+  };
+
+  void update_output_blocks(const size_t fileIndex);
+  void gather(
+    const size_t fileIndex,
+    const std::vector<std::pair<std::string, stk::util::Parameter> >& globals,
+    Snapshot& snapshot) const;
+  void define_and_write(
+    const size_t fileIndex,
+    const double time,
+    const std::vector<std::pair<std::string, stk::util::Parameter> >& globals);
+  void write(Snapshot& snapshot);
+  void run();
+  void rethrow_pending_error();
+
+  stk::mesh::BulkData& bulk_;
+  const size_t maxInFlight_;
+
+  // the writer's databases live on a duplicate of the mesh communicator
+  MPI_Comm comm_;
+  std::unique_ptr<stk::io::StkMeshIoBroker> ioBroker_;
+
+  // fields of each database and the Ioss blocks they are written to
+  std::map<size_t, std::vector<OutputField> > fileFields_;
+  std::map<size_t, std::vector<OutputBlock> > fileBlocks_;
+  std::map<size_t, size_t> fileBlocksMeshCount_;
+
+  // databases whose first step defined the output mesh
+  std::map<size_t, Ioss::Region*> definedFiles_;
+
+  std::mutex mutex_;
+  std::condition_variable queueChanged_;
+  std::deque<Snapshot> queue_;
+  size_t numInFlight_{0};
+  bool shutdown_{false};
+  std::exception_ptr error_;
+
+  std::thread worker_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -42,6 +42,7 @@ public:
   bool computeReynoldsStress_;
   bool computeTke_;
   bool computeFavreStress_;
+  bool computeReynoldsThirdMoment_{false};
   bool computeFavreTke_;
   bool computeResolvedStress_{false};
   bool computeSFSStress_{false};
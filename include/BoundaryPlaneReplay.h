@@ -0,0 +1,122 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef BoundaryPlaneReplay_h
+#define BoundaryPlaneReplay_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Stream boundary planes written by BoundaryPlaneSampler onto side sets
+ *
+ *  The files <file_prefix>_*.h5 are indexed once; the nodes of each
+ *  specification are matched to the sampled points by coordinates (plus an
+ *  optional offset, e.g. from the precursor outflow to the inflow). Every
+ *  step the two samples that bracket the current time are read one plane
+ *  at a time and linearly interpolated into the target fields, which are
+ *  typically the velocity_bc of an inflow boundary with external_data.
+ *
+ *  Only rank 0 reads the files; it matches the nodes of all ranks and
+ *  scatters to each rank the values of its matched points alone.
+ */
+class BoundaryPlaneReplay
+{
+public:
+  explicit BoundaryPlaneReplay(const YAML::Node& node);
+  ~BoundaryPlaneReplay() = default;
+
+  void load(const YAML::Node& node);
+
+  //! Index the files and match the nodes; after the mesh is populated
+  void initialize(stk::mesh::BulkData& bulk);
+
+  //! Fill the target fields at currentTime; clamped to the sampled times;
+  //! call on all ranks
+  void execute(const double currentTime);
+
+private:
+  struct ReplayField
+  {
+    std::string fileName;
+    std::string meshName;
+    const stk::mesh::FieldBase* field{nullptr};
+    int offset{0};
+    int size{0};
+  };
+
+  struct ReplaySpec
+  {
+    std::string name;
+    std::vector<std::string> targetNames;
+    std::vector<double> coordinateOffset;
+    std::vector<ReplayField> fields;
+
+    int numPoints{0};
+    int numComponents{0};
+    size_t numTargetNodes{0};
+
+    // local nodes; node inp holds values [inp*numComponents, ...) of a plane
+    std::vector<stk::mesh::Entity> nodes;
+
+    // rank 0: matched point of the nodes of every rank in rank order, and
+    // the value counts and displacements of the scatter
+    std::vector<int> points;
+    std::vector<int> valueCounts;
+    std::vector<int> valueOffsets;
+
+    // resident planes, keyed by sample index
+    std::map<int, std::vector<double> > planes;
+  };
+
+  struct Sample
+  {
+    double time;
+    int file;
+    int index;
+  };
+
+  void index_files();
+  void match_nodes(ReplaySpec& spec);
+  const std::vector<double>& plane(ReplaySpec& spec, const int sample);
+
+  stk::mesh::BulkData* bulk_{nullptr};
+
+  std::string filePrefix_{"boundary_planes"};
+  double searchTolerance_{1.0e-6};
+
+  std::vector<ReplaySpec> specs_;
+
+  std::vector<std::string> files_;
+  std::vector<Sample> samples_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,137 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef BoundaryPlaneSampler_h
+#define BoundaryPlaneSampler_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <future>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class H5IO;
+
+/** MPI count or displacement of size elements; throws if it overflows an int
+ */
+int boundary_plane_mpi_count(const size_t size, const std::string& what);
+
+/** Sample nodal fields on side sets into compact, time-indexed planes
+ *
+ *  Every output_frequency steps the fields on the nodes of each
+ *  specification are gathered on rank 0, one plane at a time, into a
+ *  buffer. Every buffer_steps samples rank 0 writes the buffer to one HDF5
+ *  file, <file_prefix>_<first step>.h5, through H5IO on a background thread
+ *  while the solve proceeds:
+ *
+ *  - attributes spatial_dimension, number_of_samples, time_steps and a
+ *    "time" dataset at the root;
+ *  - one group per specification with the attributes field_names,
+ *    field_sizes and number_of_points, and the datasets node_ids,
+ *    coordinates [point][dim] and values [sample][point][component].
+ *
+ *  Points are ordered by node id, so that each sample is one contiguous
+ *  plane that BoundaryPlaneReplay reads on its own.
+ */
+class BoundaryPlaneSampler
+{
+public:
+  explicit BoundaryPlaneSampler(const YAML::Node& node);
+  ~BoundaryPlaneSampler();
+
+  void load(const YAML::Node& node);
+
+  //! Resolve the parts and fields; after the mesh is populated
+  void initialize(stk::mesh::BulkData& bulk);
+
+  //! Gather a sample if this is an output step; call on all ranks
+  void execute(const double currentTime, const int timeStepCount);
+
+  //! Write the buffered samples and block until every file is written
+  void flush();
+
+private:
+  struct PlaneSpec
+  {
+    std::string name;
+    std::vector<std::string> targetNames;
+    std::vector<std::string> fieldNames;
+
+    stk::mesh::PartVector parts;
+    std::vector<const stk::mesh::FieldBase*> fields;
+    std::vector<int> fieldSizes;
+    int numComponents{0};
+
+    // locally owned nodes of the current buffer and one sample of them
+    std::vector<stk::mesh::Entity> nodes;
+    std::vector<double> sample;
+
+    // rank 0: value counts and displacements of every rank, the node id
+    // order of the gathered points, and the buffered planes
+    std::vector<int> valueCounts;
+    std::vector<int> valueOffsets;
+    std::vector<size_t> order;
+    std::vector<double> gathered;
+    std::vector<double> ids;
+    std::vector<double> coords;
+    std::vector<double> values;
+  };
+
+  //! Buffer of one file, handed over to the writer thread
+  struct PlaneFile
+  {
+    std::string fileName;
+    int nDim{0};
+    std::vector<double> times;
+    std::vector<int> timeSteps;
+    std::vector<PlaneSpec> specs;
+  };
+
+  void collect_nodes(PlaneSpec& spec);
+  void gather_sample(PlaneSpec& spec);
+  void write_buffer();
+  static void write_file(const PlaneFile& file);
+
+  stk::mesh::BulkData* bulk_{nullptr};
+
+  int outputFreq_{1};
+  int bufferSteps_{10};
+  std::string filePrefix_{"boundary_planes"};
+
+  std::vector<PlaneSpec> specs_;
+
+  // samples in the buffer and the mesh they were taken on
+  std::vector<double> times_;
+  std::vector<int> timeSteps_;
+  size_t syncCount_{0};
+
+  // file being written on rank 0
+  std::future<void> pendingWrite_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -148,6 +148,13 @@ public:
   void provide_output_txt(const double currentTime);
   void provide_output_exodus(const double currentTime);
 
+  // buffer a sample of all locally owned probes for the binary output
+  void sample_output_binary(const double currentTime);
+
+  // collectively write the buffered samples to one file, gathering one
+  // sample at a time on rank 0; call on all ranks
+  void flush_output_binary();
+
   
   // provide the inactive selector
   stk::mesh::Selector &get_inactive_selector();
@@ -185,9 +192,18 @@ private:
   double previousTime_;
   bool useExo_{false};
   bool useText_{false};
+  bool useBinary_{false};
   std::string exoName_;
   size_t fileIndex_;
   size_t precisionvar_;
+
+  // binary output; samples of each probe, indexed by global probe number,
+  // are buffered locally for binaryBufferSteps_ output steps
+  std::string binaryName_{"data_probes"};
+  int binaryBufferSteps_{10};
+  std::vector<double> binaryTimes_;
+  std::vector<int> binaryTimeSteps_;
+  std::vector<std::vector<double> > binaryProbeData_;
 };
 
 } // namespace nalu
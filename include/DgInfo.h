@@ -17,6 +17,7 @@
 //==============================================================================
 
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
 #include <stk_topology/topology.hpp>
 
 #include <vector>
@@ -36,7 +37,8 @@ class MasterElement;
  * - class for halo stuff.
  *
  * @par Design Considerations:
- * -
+ * - instances live contiguously in the NonConformalInfo store; coordinate
+ *   data points into its flat (gauss point major) coordinate arrays
  */
 //=============================================================================
 class DgInfo {
@@ -56,7 +58,10 @@ class DgInfo {
     MasterElement *meSCSurrent,
     stk::topology currentElementTopo,
     const int nDim,
-    double searchTolerance);
+    double searchTolerance,
+    double *currentGaussPointCoords,
+    double *currentIsoParCoords,
+    double *opposingIsoParCoords);
   
   ~DgInfo();
 
@@ -86,6 +91,9 @@ class DgInfo {
   // search provides opposing face
   stk::mesh::Entity opposingFace_;
 
+  // identifier of opposingFace_; the handle alone may be reused after ghosting changes
+  stk::mesh::EntityId opposingFaceId_;
+
   // face:element relations provide connected element to opposing face
   stk::mesh::Entity opposingElement_;
 
@@ -101,18 +109,41 @@ class DgInfo {
   // master element for opposing face connected element
   MasterElement *meSCSOpposing_;
 
-  // coordinates of gauss points on current face
-  std::vector<double> currentGaussPointCoords_;
+  // coordinates of gauss points on current face (nDim, owned by the store)
+  double *currentGaussPointCoords_;
 
   // iso-parametric coordinates for gauss point on current face (-1:1)
-  std::vector<double> currentIsoParCoords_;
+  double *currentIsoParCoords_;
 
   // iso-parametric coordinates for gauss point on opposing face (-1:1)
-  std::vector<double> opposingIsoParCoords_;  
+  double *opposingIsoParCoords_;
+};
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// DgInfoFaceRange
+//=============================================================================
+/**
+ * * @par Description:
+ * - contiguous range of the DgInfo objects on a single exposed face
+ */
+//=============================================================================
+class DgInfoFaceRange {
+
+ public:
+
+  DgInfoFaceRange(DgInfo *first, size_t size)
+    : first_(first),
+      size_(size)
+  {}
+
+  size_t size() const { return size_; }
+  DgInfo *operator[](size_t k) const { return first_ + k; }
 
-  // possible reuse
-  std::vector<uint64_t> allOpposingFaceIds_;
-  std::vector<uint64_t> allOpposingFaceIdsOld_;
+ private:
+  DgInfo *first_;
+  size_t size_;
 };
   
 } // end sierra namespace
@@ -0,0 +1,104 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef EntityColoring_h
+#define EntityColoring_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// EntityColoring
+//=============================================================================
+/**
+ * * @par Description:
+ * - Greedy coloring of the selected entities of one rank such that no two
+ *   entities of the same color share a node. Loops that visit one color at a
+ *   time can accumulate into nodal rows and fields with plain stores.
+ *
+ * @par Design Considerations:
+ * - Atomics serialize on shared rows on the host execution spaces; on GPUs
+ *   they are cheap, the device copies of the coefficient appliers cannot see
+ *   the host side flags, and the coloring is not supported.
+ * - The entities of each color are kept in bucket order so that the colored
+ *   loops retain the locality of the bucket loops.
+ */
+//=============================================================================
+
+class EntityColoring
+{
+public:
+  using EntityIndexView = Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>;
+
+  //! Entities handled by one team of the colored team loops
+  static constexpr size_t chunkSize = 512;
+
+  EntityColoring(
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::Selector& selector);
+
+  ~EntityColoring() = default;
+
+  static constexpr bool is_supported()
+  {
+#ifdef KOKKOS_ENABLE_CUDA
+    return false;
+#else
+    return true;
+#endif
+  }
+
+  //! Recompute the colors if the mesh was modified since the last call
+  void update(const stk::mesh::BulkData& bulk);
+
+  int num_colors() const { return colorOffsets_.size() - 1; }
+
+  size_t num_entities(const int color) const
+  { return colorOffsets_[color + 1] - colorOffsets_[color]; }
+
+  //! Number of chunkSize blocks, i.e. teams, of a color
+  size_t num_chunks(const int color) const
+  { return (num_entities(color) + chunkSize - 1) / chunkSize; }
+
+  //! Bucket indices of the entities of a color
+  EntityIndexView color_entities(const int color) const
+  {
+    return Kokkos::subview(
+      entities_, Kokkos::make_pair(colorOffsets_[color], colorOffsets_[color + 1]));
+  }
+
+  stk::mesh::EntityRank rank() const { return rank_; }
+
+private:
+  const stk::mesh::EntityRank rank_;
+  const stk::mesh::Selector selector_;
+
+  size_t syncCount_{0};
+  bool built_{false};
+
+  std::vector<size_t> colorOffsets_{0};
+  EntityIndexView entities_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
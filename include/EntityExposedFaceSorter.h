@@ -15,6 +15,8 @@
 #include <stk_mesh/base/BulkData.hpp>
 #include <stk_mesh/base/MetaData.hpp>
 
+#include <algorithm>
+
 namespace sierra {
 namespace nalu {
 
@@ -29,6 +31,7 @@ namespace nalu {
  *
  * @par Design Considerations:
  * - We want to sort based on exposed face ordinal - all exposed faces
+ * - The sort is stable, so a prior (locality) order holds within an ordinal
  */
 //=============================================================================
 
@@ -40,7 +43,7 @@ class EntityExposedFaceSorter : public stk::mesh::EntitySorterBase {
   {
     stk::mesh::EntityRank entityVecRank = bulk.entity_rank(entityVector[0]);    
     if ( entityVecRank == bulk.mesh_meta_data().side_rank() ) {
-      std::sort(entityVector.begin(), entityVector.end(),
+      std::stable_sort(entityVector.begin(), entityVector.end(),
         [&bulk](stk::mesh::Entity a, stk::mesh::Entity b) {
         return bulk.begin_element_ordinals(a)[0] > bulk.begin_element_ordinals(b)[0]; });
     }
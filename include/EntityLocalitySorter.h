@@ -0,0 +1,98 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+
+#ifndef EntityLocalitySorter_h
+#define EntityLocalitySorter_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// EntityLocalitySorter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Class that sorts the entities of each bucket partition for locality.
+ *   Nodes are ordered along a Hilbert or Morton curve through their model
+ *   coordinates, or by reverse Cuthill-McKee of the node graph. Edges, faces
+ *   and elements, sides included, are then ordered by the position of their
+ *   lowest node.
+ *
+ * @par Design Considerations:
+ * - STK sorts the partitions rank by rank, so the nodes are in place when the
+ *   connected entities are sorted. Bucket placement follows the sorted order,
+ *   and with it every bucket loop and the row LIDs of the linear systems.
+ * - In 2D the edges are the sides. When the EntityExposedFaceSorter runs
+ *   afterwards it groups the sides by exposed face ordinal; its sort is
+ *   stable, so the locality order holds among sides of the same ordinal.
+ */
+//=============================================================================
+
+class EntityLocalitySorter : public stk::mesh::EntitySorterBase {
+
+public:
+  enum Method {
+    HILBERT,
+    MORTON,
+    RCM
+  };
+
+  EntityLocalitySorter(
+    const stk::mesh::FieldBase& coordinates,
+    const Method method);
+
+  virtual ~EntityLocalitySorter() {}
+
+  virtual void sort(
+    stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& entityVector) const;
+
+  /** Method from its input name: hilbert, morton or rcm
+   */
+  static Method method_from_string(const std::string& name);
+
+  /** Position of a point along the space-filling curve
+   *
+   * @param[in] q     Coordinates quantized to bitsPerDim bits
+   * @param[in] nDim  Number of dimensions, 2 or 3
+   */
+  static uint64_t hilbert_key(uint32_t* q, const int nDim, const int bitsPerDim);
+  static uint64_t morton_key(const uint32_t* q, const int nDim, const int bitsPerDim);
+
+private:
+  void sort_nodes_curve(
+    stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& nodes) const;
+
+  void sort_nodes_rcm(
+    stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& nodes) const;
+
+  void sort_by_lowest_node(
+    stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& entities) const;
+
+  const stk::mesh::FieldBase& coordinates_;
+  const Method method_;
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
@@ -252,17 +252,29 @@ static const std::string TurbulenceModelConstantNames[] = {
   "v2cMu",
   "END"};
 
+/** Entities visited by the algorithms of an overlapped assembly
+ *
+ *  \sa Realm::assembly_phase_selector
+ */
+enum AssemblyPhase {
+  ASSEMBLE_ALL = 0,
+  ASSEMBLE_INTERFACE,
+  ASSEMBLE_INTERIOR
+};
+
 enum ActuatorType {
   ActLinePointDrag = 0,
   ActLineFAST = 1,
   ActDiskFAST = 2,
+  ActLineAnalytic = 3,
   ActuatorType_END
 };
 
  static std::map<std::string, ActuatorType> ActuatorTypeMap = {
      {"ActLinePointDrag",ActuatorType::ActLinePointDrag},
      {"ActLineFAST",ActuatorType::ActLineFAST},
-     {"ActDiskFAST",ActuatorType::ActDiskFAST}
+     {"ActDiskFAST",ActuatorType::ActDiskFAST},
+     {"ActLineAnalytic",ActuatorType::ActLineAnalytic}
  };
 
 } // namespace nalu
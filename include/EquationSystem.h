@@ -21,6 +21,8 @@
 
 #include <stk_ngp/Ngp.hpp>
 
+#include <memory>
+
 namespace stk{
 struct topology;
 namespace mesh{
@@ -41,6 +43,7 @@ class InitialCondition;
 class EquationSystems;
 class LinearSystem;
 class PostProcessingData;
+struct TpetraPatternCache;
 
 /** Base class representation of a PDE.
  *
@@ -285,6 +288,9 @@ public:
 
   void update_iteration_statistics(
     const int & iters);
+
+  //! Path under which the timers of this system are held in TimerDatabase
+  std::string timer_prefix() const;
   
   bool bc_data_specified(
     const UserData&, std::string &name);
@@ -351,6 +357,10 @@ public:
   //! the counter when performing matrix reinitializations.
   size_t linsysWriteCounter_{0};
 
+  //! Sparsity pattern of the linear system retained across matrix
+  //! reinitializations; only populated when pattern reuse is requested
+  std::shared_ptr<TpetraPatternCache> linsysPatternCache_;
+
   std::string dofName_{"undefined"};
 
   int numOversetIters_{1};
@@ -169,6 +169,7 @@ class EquationSystems
    */
   bool solve_and_update();
   double provide_system_norm();
+  double provide_max_system_norm();
   double provide_mean_system_norm();
 
   void predict_state();
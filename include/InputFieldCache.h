@@ -0,0 +1,124 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef InputFieldCache_h
+#define InputFieldCache_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ioss {
+class NodeBlock;
+class Region;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Resident time planes of nodal input fields read from the input mesh
+ *
+ *  Replaces the per-step read_defined_input_fields() of an external field
+ *  provider. The steps of the input database that bracket the requested
+ *  time are kept in host buffers, together with the next numPrefetch steps,
+ *  and the fields are interpolated in time from memory. With asynchronous
+ *  prefetch the steps ahead are read by a background thread while the
+ *  solver proceeds; a step that is not yet resident when it is needed is
+ *  waited for (or read on the calling thread in synchronous mode).
+ *
+ *  The reader thread only touches the Ioss region of the input database,
+ *  which the caller must not use while the cache exists. It makes no MPI
+ *  calls, so the input must not be decomposed on the fly. Reads hold
+ *  library_io_mutex(), which serializes them with the async output writer.
+ */
+class InputFieldCache
+{
+public:
+  InputFieldCache(
+    stk::mesh::BulkData& bulk,
+    std::shared_ptr<Ioss::Region> region,
+    const int numPrefetch,
+    const bool asynchronous);
+
+  ~InputFieldCache();
+
+  //! Cache a nodal field stored as dbName; false if the database lacks it
+  bool add_field(stk::mesh::FieldBase& field, const std::string& dbName);
+
+  //! Fill the fields at a database time, snapping to the closest step if
+  //! interpolate is false; returns the time of the data as the io broker does
+  double populate(const double dbTime, const bool interpolate);
+
+  //! Time the calling thread spent reading or waiting for steps
+  double stallTime_{0.0};
+
+private:
+  InputFieldCache(const InputFieldCache&) = delete;
+  InputFieldCache& operator=(const InputFieldCache&) = delete;
+
+  struct CachedField
+  {
+    stk::mesh::FieldBase* field{nullptr};
+    std::string dbName;
+    int numComponents{1};
+  };
+
+  // one value array per cached field, in node block order
+  typedef std::vector<std::vector<double> > Plane;
+
+  void read_step(const int step, Plane& plane);
+  const Plane& require_step(const int step);
+  void request_locked(const int step, const bool urgent);
+  void run();
+  void rethrow_pending_error();
+
+  stk::mesh::BulkData& bulk_;
+  std::shared_ptr<Ioss::Region> region_;
+  Ioss::NodeBlock* nodeBlock_{nullptr};
+  const int numPrefetch_;
+  const bool asynchronous_;
+
+  // database times of the steps 1..numSteps and the mesh node of each
+  // node block entry; invalid for nodes not on this process
+  std::vector<double> stepTimes_;
+  std::vector<stk::mesh::Entity> nodes_;
+  std::vector<CachedField> fields_;
+
+  std::mutex mutex_;
+  std::condition_variable stepReady_;
+  std::map<int, Plane> planes_;
+  std::deque<int> requests_;
+  std::set<int> pending_;
+  bool shutdown_{false};
+  std::exception_ptr error_;
+
+  std::thread worker_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
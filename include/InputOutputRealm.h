@@ -16,6 +16,7 @@
 
 // standard c++
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -29,6 +30,7 @@ namespace sierra{
 namespace nalu{
 
 class Realms;
+class InputFieldCache;
 
 class InputOutputInfo {
 
@@ -75,9 +77,14 @@ public:
  
   // internal calls
   void register_io_fields();
+  void setup_input_field_cache();
 
   // hold the field information
   std::vector<InputOutputInfo *> inputOutputFieldInfo_;
+
+  // resident input steps, interpolated in time in memory; null when the
+  // io broker reads the input fields at every step
+  std::unique_ptr<InputFieldCache> inputFieldCache_;
 };
 
 } // namespace nalu
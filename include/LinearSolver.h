@@ -174,6 +174,7 @@ class LinearSolver
   LinearSolverConfig* config_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool freezePreconditioner_{false};
   double timerPrecond_;
   bool activateMueLu_{false};
 
@@ -182,6 +183,8 @@ class LinearSolver
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   //! Flag indicating whether the preconditioner is reused on each invocation
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  //! Flag indicating whether an existing preconditioner is applied without any update
+  bool & freezePreconditioner() {return freezePreconditioner_;}
 
   //! Reset the preconditioner timer to 0.0 for future accumulation
   void zero_timer_precond() { timerPrecond_ = 0.0;}
@@ -222,11 +225,32 @@ class TpetraLinearSolver : public LinearSolver
       Teuchos::RCP<LinSys::MultiVector> rhs,
       Teuchos::RCP<LinSys::MultiVector> coords);
 
+  /** Set up the solver for a block CRS system, e.g., coupled momentum
+   *
+   *  Ifpack2 block relaxation or block ILU (RBILUK) act on the dense node
+   *  blocks of the matrix.
+   */
+    void setupLinearSolver(
+      Teuchos::RCP<LinSys::MultiVector> sln,
+      Teuchos::RCP<LinSys::BlockMatrix> matrix,
+      Teuchos::RCP<LinSys::MultiVector> rhs);
+
     virtual void destroyLinearSolver() override;
 
   //! Initialize the MueLU preconditioner before solve
     void setMueLu();
 
+  /** Decide whether the adaptive reuse policy refreshes the preconditioner
+   *
+   *  A refresh is requested for the initial setup, when the relative change
+   *  of the matrix diagonal since the last refresh exceeds the configured
+   *  tolerance, when the Krylov iterations of the previous solve grew beyond
+   *  the configured factor, or after the maximum number of reused solves.
+   *
+   *  @param[out] reason Description of the trigger, for logging
+   */
+    bool preconditioner_refresh_required(std::string& reason);
+
   /** Compute the norm of the non-linear solution vector
    *
    *  @param[in] whichNorm [0, 1, 2] norm to be computed
@@ -259,6 +283,7 @@ class TpetraLinearSolver : public LinearSolver
   //! The preconditioner parameters
     const Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
     Teuchos::RCP<LinSys::Matrix> matrix_;
+    Teuchos::RCP<LinSys::BlockMatrix> blockMatrix_;
     Teuchos::RCP<LinSys::MultiVector> rhs_;
     Teuchos::RCP<LinSys::LinearProblem> problem_;
     Teuchos::RCP<LinSys::SolverManager> solver_;
@@ -267,6 +292,17 @@ class TpetraLinearSolver : public LinearSolver
     Teuchos::RCP<LinSys::MultiVector> coords_;
 
     std::string preconditionerType_;
+
+  //! The assembled operator, either the point or the block CRS matrix
+    Teuchos::RCP<const LinSys::RowMatrix> system_matrix() const;
+
+  //! Adaptive reuse state; diagonal and iterations at the last refresh
+    Teuchos::RCP<LinSys::MultiVector> refDiagonal_;
+    double diagonalChange_{0.0};
+    int refIterations_{0};
+    int solvesSinceRefresh_{0};
+    bool iterationGrowth_{false};
+    bool holdPreconditioner_{false};
 };
 
 } // namespace nalu
@@ -56,6 +56,26 @@ public:
   inline bool useSegregatedSolver() const
   { return useSegregatedSolver_; }
 
+  //! Store multi-dof systems as block CRS matrices with one index per node pair
+  inline bool useBlockCrs() const
+  { return useBlockCrs_; }
+
+  //! Refresh the preconditioner only when the matrix or convergence has drifted
+  inline bool adaptivePreconditionerReuse() const
+  { return adaptivePreconditionerReuse_; }
+
+  inline double refreshDiagonalChange() const
+  { return refreshDiagonalChange_; }
+
+  inline double refreshIterationGrowth() const
+  { return refreshIterationGrowth_; }
+
+  inline int refreshMaxSolves() const
+  { return refreshMaxSolves_; }
+
+  inline bool reuseLinearSystemPattern() const
+  { return reuseLinearSystemPattern_; }
+
   std::string get_method() const
   {return method_;}
 
@@ -84,7 +104,15 @@ protected:
   bool recomputePreconditioner_{true};
   bool reusePreconditioner_{false};
   bool useSegregatedSolver_{false};
+  bool useBlockCrs_{false};
   bool writeMatrixFiles_{false};
+  bool reuseLinearSystemPattern_{false};
+
+  // adaptive preconditioner reuse; thresholds for a refresh
+  bool adaptivePreconditionerReuse_{false};
+  double refreshDiagonalChange_{0.05};
+  double refreshIterationGrowth_{1.5};
+  int refreshMaxSolves_{0};
 };
 
 class TpetraLinearSolverConfig : public LinearSolverConfig
@@ -16,6 +16,7 @@
 #include <Tpetra_Details_DefaultTypes.hpp>
 #include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_BlockCrsMatrix.hpp>
 #include <Tpetra_Vector.hpp>
 #include <Tpetra_MultiVector.hpp>
 
@@ -84,6 +85,9 @@ struct LinSys {
   using LocalVector       = MultiVector::dual_view_type::t_host;
   using Matrix            = Tpetra::CrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
   using LocalMatrix       = Matrix::local_matrix_type;
+  using RowMatrix         = Tpetra::RowMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+  using BlockMatrix       = Tpetra::BlockCrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
+  using LocalBlockMatrix  = BlockMatrix::local_matrix_type;
   using Operator          = Tpetra::Operator<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
   using MultiVectorTraits = Belos::MultiVecTraits<Scalar, MultiVector>;
   using OperatorTraits    = Belos::OperatorTraits<Scalar,MultiVector, Operator>;
@@ -93,6 +97,9 @@ struct LinSys {
   using Preconditioner    = Ifpack2::Preconditioner<Scalar, LocalOrdinal, GlobalOrdinal, Node>;
 
   using EntityToLIDView = Kokkos::View<LocalOrdinal*, Kokkos::LayoutRight, LinSysMemSpace>;
+
+  //! Position of the (row node, column node) pairs of an edge within their matrix rows
+  using EdgeScatterView = Kokkos::View<LocalOrdinal*[4], Kokkos::LayoutRight, LinSysMemSpace>;
 };
 
 
@@ -68,8 +68,38 @@ public:
                           const SharedMemView<const double**,DeviceShmem> & lhs,
                           const char * trace_tag) = 0;
 
+  /** Sum the contributions of one edge
+   *
+   *  Linear systems that precompute where each edge scatters into the matrix
+   *  override this; the default is the generic path through operator()
+   */
+  KOKKOS_FUNCTION
+  virtual void sum_into_edge(const stk::mesh::Entity /* edge */,
+                             const ngp::Mesh::ConnectedNodes& entities,
+                             const SharedMemView<int*,DeviceShmem> & localIds,
+                             const SharedMemView<int*,DeviceShmem> & sortPermutation,
+                             const SharedMemView<const double*,DeviceShmem> & rhs,
+                             const SharedMemView<const double**,DeviceShmem> & lhs,
+                             const char * trace_tag)
+  {
+    (*this)(2, entities, localIds, sortPermutation, rhs, lhs, trace_tag);
+  }
+
   virtual void free_device_pointer() = 0;
   virtual CoeffApplier* device_pointer() = 0;
+
+  /** Accumulate with plain stores instead of atomics
+   *
+   *  Only set around loops where no two concurrent calls share a node, see
+   *  EntityColoring; implementations are free to keep the atomics
+   */
+  void set_atomic_free(const bool atomicFree) { atomicFree_ = atomicFree; }
+
+  KOKKOS_INLINE_FUNCTION
+  bool atomic_free() const { return atomicFree_; }
+
+protected:
+  bool atomicFree_{false};
 };
 
 class LinearSystem
@@ -234,6 +264,7 @@ public:
   bool & reusePreconditioner() {return reusePreconditioner_;}
   double get_timer_precond();
   void zero_timer_precond();
+  void freeze_preconditioner(const bool freeze);
   bool useSegregatedSolver() const;
 
   EquationSystem* equationSystem() { return eqSys_; }
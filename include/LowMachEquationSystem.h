@@ -19,6 +19,8 @@
 #include "NaluParsing.h"
 #include "TAMSAlgDriver.h"
 
+#include "ngp_utils/NgpTypes.h"
+
 #include "ngp_algorithms/NodalGradAlgDriver.h"
 #include "ngp_algorithms/WallFricVelAlgDriver.h"
 #include "ngp_algorithms/EffDiffFluxCoeffAlg.h"
@@ -92,10 +94,21 @@ public:
 
   virtual void predict_state();
 
-  void project_nodal_velocity();
+  // returns the bytes of nodal field data read and written
+  double project_nodal_velocity();
 
   void post_converged_work();
 
+  /** Fused node sweeps of the corrector loop
+   *
+   *  Each returns the bytes of nodal field data read and written. The
+   *  velocity and projection sweeps also update the velocity relative to
+   *  the mesh; the pressure sweep also copies the result to StateN.
+   */
+  double fused_velocity_update();
+  double fused_pressure_update(const double deltaFrac);
+  double fused_nodal_velocity_projection();
+
   const bool elementContinuityEqs_; /* allow for mixed element/edge for continuity */
   MomentumEquationSystem *momentumEqSys_;
   ContinuityEquationSystem *continuityEqSys_;
@@ -111,6 +124,9 @@ public:
 
   bool isInit_;
 
+  // combine the nodal updates of the corrector loop into fewer sweeps
+  bool fusedCorrector_{false};
+
 };
 
 /** Representation of the Momentum conservation equations in 2-D and 3-D
@@ -320,6 +336,25 @@ public:
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
 };
 
+/** Nodal velocity projection fused with the velocity relative to the mesh
+ *
+ *  u = u - (dpdx - uTmp)/(rho Udiag) on every node of s_dpdx, including aura
+ *  and custom ghosts; owned and shared nodes also get vrtm = u - u_mesh in
+ *  the same pass. Returns the bytes of nodal field data read and written.
+ */
+double fused_velocity_projection_sweep(
+  const stk::mesh::BulkData& bulk,
+  const ngp::Mesh& ngpMesh,
+  const stk::mesh::Selector& s_dpdx,
+  const int nDim,
+  const ngp::Field<double>& uTmp,
+  const ngp::Field<double>& dpdx,
+  const ngp::Field<double>& Udiag,
+  const ngp::Field<double>& rhoNp1,
+  const ngp::Field<double>& meshVel,
+  ngp::Field<double>& velNp1,
+  ngp::Field<double>& vrtm);
+
 } // namespace nalu
 } // namespace Sierra
 
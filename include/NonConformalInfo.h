@@ -17,6 +17,8 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <DgInfo.h>
+#include <FieldTypeDef.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -39,7 +41,6 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class DgInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -75,11 +76,12 @@ class NonConformalInfo {
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool   dynamicSearchTolAlg,
+    const bool   predictiveSearch,
     const std::string debugName);
 
   ~NonConformalInfo();
 
-  /* delete dgInfoVec_ */
+  /* clear the DgInfo store; capacity is kept for the next construction */
   void delete_dgInfo();
 
   /* perform initialization such as dgInfoVec creation and search point/boxes */
@@ -93,6 +95,19 @@ class NonConformalInfo {
   void construct_bounding_boxes();
   void determine_elems_to_ghost();
   void complete_search();
+  bool predict_opposing_face(
+    DgInfo *dgInfo,
+    VectorFieldType *coordinates,
+    const stk::mesh::Ghosting *ghosting,
+    std::vector<stk::mesh::Entity> &visitedFaces,
+    std::vector<double> &ws_opposing_coords);
+  void update_nearest_distance(
+    DgInfo *dgInfo,
+    MasterElement *meFC,
+    const double *isoParCoords,
+    const double *elementCoords,
+    const double nearestDistanceSaved,
+    double &nearestDistance);
   void provide_diagnosis();
   size_t error_check();
 
@@ -117,9 +132,22 @@ class NonConformalInfo {
   /* allow for dynamic search tolerance algorithm where search tolerance is used as point radius from isInElem */
   const bool dynamicSearchTolAlg_;
 
+  /* seed the search with the previous opposing face and walk its neighbors */
+  const bool predictiveSearch_;
+
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
+  /* a complete search result exists for the current store */
+  bool havePreviousSearch_;
+
+  /* gauss points resolved by the predictive search this time; indexed by localGaussPointId */
+  std::vector<char> predictedFound_;
+  size_t numPredictedFound_;
+
+  /* received non-conformal ghosts required by the predicted points */
+  std::vector<stk::mesh::Entity> ghostedElemsToKeep_;
+
   /* can we possibly reuse */
   bool canReuse_;
 
@@ -127,8 +155,22 @@ class NonConformalInfo {
   std::vector<boundingSphere>     boundingSphereVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
 
-  /* vector of DgInfo */
-  std::vector<std::vector<DgInfo *> > dgInfoVec_;
+  /* contiguous DgInfo store, gauss points of a face are adjacent */
+  std::vector<DgInfo> dgInfoStore_;
+
+  /* flat coordinate arrays (nDim per gauss point) referenced by the store */
+  std::vector<double> currentGaussPointCoords_;
+  std::vector<double> currentIsoParCoords_;
+  std::vector<double> opposingIsoParCoords_;
+
+  /* per-face ranges into dgInfoStore_ */
+  std::vector<DgInfoFaceRange> dgInfoVec_;
+
+  /* opposing face ids found by the search, offsets indexed by localGaussPointId; possible reuse */
+  std::vector<size_t> allOpposingFaceIdOffsets_;
+  std::vector<uint64_t> allOpposingFaceIds_;
+  std::vector<size_t> allOpposingFaceIdOffsetsOld_;
+  std::vector<uint64_t> allOpposingFaceIdsOld_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
@@ -66,6 +66,11 @@ public:
   int restartCompressionLevel_;
   bool restartCompressionShuffle_;
 
+  // write results/restart steps from a background thread
+  bool asyncOutput_;
+  bool asyncRestart_;
+  int maxInFlightSnapshots_;
+
   std::pair<bool, double> userWallTimeResults_;
   std::pair<bool, double> userWallTimeRestart_;
 
@@ -0,0 +1,98 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef ParallelSumPlan_h
+#define ParallelSumPlan_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Persistent, split-phase sum of field contributions on shared entities
+ *
+ *  The shared nodes, edges and faces are listed once per neighbor in entity
+ *  key order, so both sides agree on the packing order without exchanging
+ *  keys. begin_sum packs the local contributions and posts the messages;
+ *  end_sum waits and replaces each shared value with the sum over all
+ *  sharing ranks, added in rank order so that every rank holds the same
+ *  bits. Equivalent to stk::mesh::parallel_sum on double fields. Between
+ *  the two calls the shared values must not be modified, while the rest
+ *  of the fields may be.
+ */
+class ParallelSumPlan
+{
+public:
+  ParallelSumPlan() = default;
+  ~ParallelSumPlan();
+
+  //! Gather the shared entity lists; local operation, no messages
+  void build(const stk::mesh::BulkData& bulk);
+
+  //! True when the plan was built against the current mesh modification cycle
+  bool is_current(const stk::mesh::BulkData& bulk) const;
+
+  //! Post receives, pack the local contributions and post sends
+  void begin_sum(const std::vector<const stk::mesh::FieldBase*>& fields);
+
+  //! Wait for the messages and sum the contributions into the shared entities
+  void end_sum();
+
+  void sum(const std::vector<const stk::mesh::FieldBase*>& fields)
+  {
+    begin_sum(fields);
+    end_sum();
+  }
+
+  size_t num_neighbors() const { return neighbors_.size(); }
+
+private:
+  ParallelSumPlan(const ParallelSumPlan&) = delete;
+  ParallelSumPlan& operator=(const ParallelSumPlan&) = delete;
+
+  size_t message_size(const std::vector<stk::mesh::Entity>& entities) const;
+  void pack(const std::vector<stk::mesh::Entity>& entities, std::vector<double>& buffer) const;
+  void add(const std::vector<stk::mesh::Entity>& entities, const std::vector<double>& buffer) const;
+
+  const stk::mesh::BulkData* bulk_{nullptr};
+  size_t modCount_{0};
+  MPI_Comm comm_{MPI_COMM_NULL};
+  int myRank_{0};
+
+  // every shared entity, and per neighbor rank the entities shared with it
+  std::vector<stk::mesh::Entity> sharedEntities_;
+  std::vector<int> neighbors_;
+  std::vector<std::vector<stk::mesh::Entity>> neighborEntities_;
+
+  std::vector<double> localBuffer_;
+  std::vector<std::vector<double>> sendBuffers_;
+  std::vector<std::vector<double>> recvBuffers_;
+  std::vector<MPI_Request> requests_;
+
+  // fields of the sum in flight
+  std::vector<const stk::mesh::FieldBase*> fields_;
+  bool inFlight_{false};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,94 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef PeriodicCommPlan_h
+#define PeriodicCommPlan_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class Ghosting;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Persistent owner-to-ghost communication plan for a custom ghosting
+ *
+ *  The send and receive entity lists of the ghosting are gathered once per
+ *  neighbor and sorted by entity key, so both sides agree on the packing
+ *  order without exchanging keys. All fields of an exchange are packed into
+ *  a single message per neighbor; the pack buffers persist between calls
+ *  and only grow. The exchange is split into begin/end so that work that
+ *  does not touch the ghosted values can proceed while messages are in
+ *  flight. Equivalent to stk::mesh::communicate_field_data on the ghosting.
+ */
+class PeriodicCommPlan
+{
+public:
+  PeriodicCommPlan() = default;
+  ~PeriodicCommPlan();
+
+  //! Gather the neighbor lists of the ghosting; local operation, no messages
+  void build(const stk::mesh::BulkData& bulk, const stk::mesh::Ghosting& ghosting);
+
+  //! True when the plan was built against the current mesh modification cycle
+  bool is_current(const stk::mesh::BulkData& bulk) const;
+
+  //! Post receives, pack owned values and post sends
+  void begin_exchange(const std::vector<const stk::mesh::FieldBase*>& fields);
+
+  //! Wait for the messages and unpack into the ghosted entities
+  void end_exchange();
+
+  void exchange(const std::vector<const stk::mesh::FieldBase*>& fields)
+  {
+    begin_exchange(fields);
+    end_exchange();
+  }
+
+  size_t num_neighbors() const { return neighbors_.size(); }
+
+private:
+  PeriodicCommPlan(const PeriodicCommPlan&) = delete;
+  PeriodicCommPlan& operator=(const PeriodicCommPlan&) = delete;
+
+  size_t message_bytes(const std::vector<stk::mesh::Entity>& entities) const;
+
+  const stk::mesh::BulkData* bulk_{nullptr};
+  size_t modCount_{0};
+  MPI_Comm comm_{MPI_COMM_NULL};
+
+  // neighbor ranks and, per neighbor, the entities sent and received
+  std::vector<int> neighbors_;
+  std::vector<std::vector<stk::mesh::Entity>> sendEntities_;
+  std::vector<std::vector<stk::mesh::Entity>> recvEntities_;
+
+  std::vector<std::vector<unsigned char>> sendBuffers_;
+  std::vector<std::vector<unsigned char>> recvBuffers_;
+  std::vector<MPI_Request> requests_;
+
+  // fields of the exchange in flight
+  std::vector<const stk::mesh::FieldBase*> fields_;
+  bool inFlight_{false};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
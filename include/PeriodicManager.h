@@ -17,6 +17,7 @@
 //==============================================================================
 
 #include <FieldTypeDef.h>
+#include <PeriodicCommPlan.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -68,6 +69,14 @@ class PeriodicManager {
     const bool &addSlaves = true,
     const bool &setSlaves = true);
 
+  // as above for several fields; one message per neighbor and stage
+  void apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true);
+
   void ngp_apply_constraints(
     stk::mesh::FieldBase *,
     const unsigned &sizeOfField,
@@ -75,6 +84,13 @@ class PeriodicManager {
     const bool &addSlaves = true,
     const bool &setSlaves = true);
 
+  void ngp_apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true);
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
@@ -119,15 +135,37 @@ class PeriodicManager {
   periodic_parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  /* all fields share one message per neighbor */
+  void
+  periodic_parallel_communicate_fields(
+    const std::vector<stk::mesh::FieldBase *> &fields);
+
+  /* split exchange; work between begin and end must not touch periodic ghosts */
+  void
+  begin_periodic_parallel_communicate_fields(
+    const std::vector<stk::mesh::FieldBase *> &fields);
+
+  void
+  end_periodic_parallel_communicate_fields();
+
   void
   ngp_periodic_parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  /* double fields; one host round trip and message per neighbor */
+  void
+  ngp_periodic_parallel_communicate_fields(
+    const std::vector<stk::mesh::FieldBase *> &fields);
+
   /* communicate shared nodes and aura nodes */
   void
   parallel_communicate_field(
     stk::mesh::FieldBase *theField);
 
+  void
+  parallel_communicate_fields(
+    const std::vector<stk::mesh::FieldBase *> &fields);
+
   void
   ngp_parallel_communicate_field(
     stk::mesh::FieldBase *theField);
@@ -156,6 +194,7 @@ class PeriodicManager {
 
   std::vector<int> ghostCommProcs_;
 
+  // device master/slave updates; the periodic ghosts must be current
   void ngp_add_slave_to_master(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
@@ -168,6 +207,11 @@ class PeriodicManager {
 
  private:
 
+  // persistent exchange on periodicGhosting_; rebuilt with the ghosting
+  PeriodicCommPlan commPlan_;
+
+  PeriodicCommPlan & comm_plan();
+
   // vector of master:slave selector pairs
   std::vector<SelectorPair> periodicSelectorPairs_;
 
@@ -189,6 +233,7 @@ class PeriodicManager {
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
+  // local master/slave updates; the periodic ghosts must be current
   void add_slave_to_master(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
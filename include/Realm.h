@@ -32,7 +32,9 @@
 
 // standard c++
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <stdint.h>
 
@@ -54,7 +56,9 @@ namespace nalu{
 
 class Algorithm;
 class AlgorithmDriver;
+class AsyncOutputWriter;
 class AuxFunctionAlgorithm;
+class EntityColoring;
 class GeometryAlgDriver;
 
 class NonConformalManager;
@@ -83,6 +87,8 @@ class DataProbePostProcessing;
 class Actuator;
 class ABLForcingAlgorithm;
 class BdyLayerStatistics;
+class BoundaryPlaneSampler;
+class BoundaryPlaneReplay;
 
 class TensorProductQuadratureRule;
 class LagrangeBasis;
@@ -146,6 +152,18 @@ class Realm {
 
   void create_output_mesh();
   void create_restart_mesh();
+  void setup_async_output();
+
+  // block until background results/restart writes have completed; required
+  // before the mesh is modified
+  void wait_for_output();
+
+  // start a modification of this realm's mesh once pending background
+  // writes, which hold bucket pointers, have completed
+  void mesh_modification_begin();
+
+  // write any post processing output still buffered; end of simulation
+  void flush_post_processing_output();
   void input_variables_from_mesh();
 
   void augment_output_variable_list(
@@ -236,6 +254,12 @@ class Realm {
     const unsigned &sizeOfTheField,
     const bool &bypassFieldCheck = true) const;
 
+  // all fields in one periodic exchange per stage
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<unsigned> &sizeOfTheFields,
+    const bool &bypassFieldCheck = true) const;
+
   void periodic_field_max(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfTheField) const;
@@ -285,6 +309,7 @@ class Realm {
 
   void dump_simulation_time();
   double provide_mean_norm();
+  double provide_max_norm();
 
   double get_hybrid_factor(
     const std::string dofname);
@@ -386,6 +411,27 @@ class Realm {
   // inactive part
   stk::mesh::Selector get_inactive_selector();
 
+  /** Coloring of the locally owned, active entities of the given parts
+   *
+   *  Cached per (rank, parts) and recomputed after mesh modifications
+   */
+  EntityColoring& entity_coloring(
+    const stk::mesh::EntityRank rank,
+    const stk::mesh::PartVector& parts);
+
+  /** Entities of the current assembly phase
+   *
+   *  All entities unless an overlapped driver is assembling either the
+   *  entities that touch shared nodes or the remaining, interior ones
+   */
+  stk::mesh::Selector assembly_phase_selector() const;
+
+  //! True if the drivers overlap the shared-node sums with interior assembly
+  bool overlaps_parallel_assembly() const { return parallelInterfacePart_ != nullptr; }
+
+  //! Tag the owned entities that touch shared nodes; collective
+  void mark_parallel_interface();
+
   // push back equation to equation systems vector
   void push_equation_to_systems(
     EquationSystem *eqSystem);
@@ -453,6 +499,8 @@ class Realm {
   Actuator *actuator_;
   ABLForcingAlgorithm *ablForcingAlg_;
   BdyLayerStatistics* bdyLayerStats_{nullptr};
+  std::unique_ptr<BoundaryPlaneSampler> boundaryPlaneSampler_;
+  std::unique_ptr<BoundaryPlaneReplay> boundaryPlaneReplay_;
   std::unique_ptr<MeshMotionAlg> meshMotionAlg_;
 
   std::vector<Algorithm *> propertyAlg_;
@@ -476,6 +524,7 @@ class Realm {
   double timerSkinMesh_;
   double timerPromoteMesh_;
   double timerSortExposedFace_;
+  double timerSortLocality_;
 
   NonConformalManager *nonConformalManager_;
   OversetManager *oversetManager_;
@@ -524,6 +573,17 @@ class Realm {
   bool rebalanceMesh_{false};
   
   std::string rebalanceMethod_;
+
+  // load-time node/edge/element ordering for locality; none, hilbert, morton or rcm
+  std::string reorderMethod_{"none"};
+
+  // atomic-free assembly over node-disjoint entity colors (host builds only)
+  bool coloredAssembly_{false};
+
+  // overlap the shared-node sums of the NGP drivers with interior assembly
+  bool overlapParallelAssembly_{false};
+  stk::mesh::Part* parallelInterfacePart_{nullptr};
+  AssemblyPhase assemblyPhase_{ASSEMBLE_ALL};
    
   // allow aura to be optional
   bool activateAura_;
@@ -620,6 +680,7 @@ class Realm {
 
   // tools
   std::unique_ptr<PromotedElementIO> promotionIO_; // mesh outputer
+  std::unique_ptr<AsyncOutputWriter> asyncOutput_; // background results/restart writer
   std::vector<std::string> superTargetNames_;
 
   void setup_element_promotion(); // create super parts
@@ -679,6 +740,9 @@ class Realm {
 protected:
   std::unique_ptr<NgpMeshInfo> meshInfo_;
 
+  std::map<std::pair<stk::mesh::EntityRank, std::vector<unsigned>>,
+           std::unique_ptr<EntityColoring>> entityColorings_;
+
   unsigned meshModCount_{0};
 
 };
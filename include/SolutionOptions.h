@@ -152,6 +152,8 @@ public:
   double inputVariablesRestorationTime_;
   bool inputVariablesInterpolateInTime_;
   double inputVariablesPeriodicTime_;
+  int inputVariablesPrefetchSteps_;
+  bool inputVariablesAsyncPrefetch_;
   bool consistentMMPngDefault_;
   bool useConsolidatedSolverAlg_;
   bool useConsolidatedBcSolverAlg_;
@@ -46,6 +46,17 @@ struct NGPApplyCoeff
     SharedMemView<double**,DeviceShmem> & lhs,
     const char *trace_tag) const;
 
+  //! Apply the contributions of one edge, see CoeffApplier::sum_into_edge
+  KOKKOS_FUNCTION
+  void sum_into_edge(
+    const stk::mesh::Entity edge,
+    const ngp::Mesh::ConnectedNodes& symMeshobjs,
+    const SharedMemView<int*,DeviceShmem> & scratchIds,
+    const SharedMemView<int*,DeviceShmem> & sortPermutation,
+    SharedMemView<double*,DeviceShmem> & rhs,
+    SharedMemView<double**,DeviceShmem> & lhs,
+    const char *trace_tag) const;
+
   KOKKOS_FUNCTION
   void extract_diagonal(
     const unsigned nEntities,
@@ -88,6 +99,12 @@ protected:
   NGPApplyCoeff coeff_applier()
   { return NGPApplyCoeff(eqSystem_); }
 
+  /** Sum into the linear system with plain stores
+   *
+   *  Only for loops over node-disjoint entity colors, see EntityColoring
+   */
+  void set_atomic_free_assembly(const bool atomicFree);
+
   // Need to find out whether this ever gets called inside a modification cycle.
   void apply_coeff(
     const std::vector<stk::mesh::Entity> & sym_meshobj,
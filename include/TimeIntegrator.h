@@ -45,6 +45,10 @@ public:
   void integrate_realm();
   void provide_mean_norm();
   bool simulation_proceeds();
+  double max_nonlinear_residual();
+  bool nonlinear_iterations_converged(
+    const int k,
+    const double maxNonlinearResidual) const;
   Simulation* sim_{nullptr};
 
   double totalSimTime_;
@@ -62,6 +66,11 @@ public:
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
 
+  // adaptive Picard loop; nonlinearIterations_ serves as the maximum
+  bool adaptiveNonlinearIterations_;
+  double nonlinearConvergenceTolerance_;
+  int nonlinearIterationsSaved_;
+
   std::string name_;
 
   std::vector<std::string> realmNamesVec_;
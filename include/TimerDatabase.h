@@ -0,0 +1,116 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef TimerDatabase_h
+#define TimerDatabase_h
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Hierarchical registry of phase timers and counters
+ *
+ *  Entries are keyed by a path, e.g., `realm_1/eqs/MomentumEQS/assemble`,
+ *  where `/` separates the levels of the hierarchy. Existing accumulators
+ *  (e.g., EquationSystem::timerAssemble_) are registered by address and
+ *  sampled at the end of every time step, so the hot paths are untouched.
+ *  Entries owned by the database are accumulated with add_time/add_count.
+ *
+ *  When active, the per-step increments are reduced across MPI ranks
+ *  (min/max/mean) and streamed by rank 0 as CSV or JSON lines rows. A
+ *  summary of the cumulative values is written to the log at the end of
+ *  the simulation.
+ *
+ *  \code{.yaml}
+ *  timing_database:
+ *    output_file_name: timings.csv
+ *    format: csv          # or json
+ *    output_frequency: 1
+ *  \endcode
+ */
+class TimerDatabase
+{
+public:
+  static TimerDatabase& self();
+
+  void load(const YAML::Node& node);
+
+  bool active() const { return active_; }
+
+  //! Register an externally owned time accumulator (seconds); no-op unless active
+  void register_timer(const std::string& name, const double* accumulator);
+
+  //! Register an externally owned counter accumulator; no-op unless active
+  void register_counter(const std::string& name, const double* accumulator);
+
+  //! Remove all entries that reference accumulators under the given prefix
+  void deregister(const std::string& prefix);
+
+  //! Accumulate time into a database-owned entry
+  void add_time(const std::string& name, const double time);
+
+  //! Accumulate a count into a database-owned entry
+  void add_count(const std::string& name, const double count = 1.0);
+
+  //! Sample all entries, reduce and stream a row if this is an output step
+  void end_time_step(const int timeStepCount, const double currentTime);
+
+  //! Summary of cumulative values (min/max/mean over ranks) to the log
+  void report();
+
+private:
+  TimerDatabase();
+  ~TimerDatabase();
+  TimerDatabase(const TimerDatabase&) = delete;
+  TimerDatabase& operator=(const TimerDatabase&) = delete;
+
+  struct Entry
+  {
+    const double* source{nullptr};
+    bool isTimer{true};
+    double lastSample{0.0};
+    double stepValue{0.0};
+    double total{0.0};
+  };
+
+  Entry& find_or_create(const std::string& name, const bool isTimer);
+  void sample();
+  void synchronize_names();
+  void write_header();
+  void write_row(
+    const int timeStepCount,
+    const double currentTime,
+    const std::vector<double>& gMin,
+    const std::vector<double>& gMax,
+    const std::vector<double>& gSum);
+
+  bool active_{false};
+  bool namesChanged_{false};
+  bool headerWritten_{false};
+  bool useJson_{false};
+  int outputFreq_{1};
+  std::string outputFileName_{"timings.csv"};
+  std::ofstream outputFile_;
+
+  std::map<std::string, Entry> entries_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -47,6 +47,37 @@ typedef std::unordered_map<stk::mesh::EntityId, size_t>  MyLIDMapType;
 
 typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> Connection;
 
+/** Sparsity pattern retained across TpetraLinearSystem reinitializations
+ *
+ *  Held by the EquationSystem so that it survives the delete/create cycle of
+ *  reinitialize_linear_system. The connectivity contributed by each graph
+ *  build call is hashed independently of entity ordering; when the hashes on
+ *  all ranks match the cached ones, the maps, graphs and importer/exporter
+ *  are reused and only the entity to column LID mapping is refreshed.
+ */
+struct TpetraPatternCache
+{
+  unsigned numDof_{0};
+  size_t signature_{0};
+  std::vector<std::string> contributionNames_;
+  std::vector<size_t> contributionHashes_;
+
+  Teuchos::RCP<LinSys::Map>    ownedRowsMap_;
+  Teuchos::RCP<LinSys::Map>    sharedNotOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Map>    totalColsMap_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+  Teuchos::RCP<LinSys::Graph>  ownedGraph_;
+  Teuchos::RCP<LinSys::Graph>  sharedNotOwnedGraph_;
+
+  // block CRS systems keep only the node maps and graphs
+  Teuchos::RCP<LinSys::Map>    ownedBlockRowsMap_;
+  Teuchos::RCP<LinSys::Map>    sharedNotOwnedBlockRowsMap_;
+  Teuchos::RCP<LinSys::Map>    totalBlockColsMap_;
+  Teuchos::RCP<LinSys::Export> blockExporter_;
+  Teuchos::RCP<LinSys::Graph>  ownedBlockGraph_;
+  Teuchos::RCP<LinSys::Graph>  sharedNotOwnedBlockGraph_;
+};
+
 
 class TpetraLinearSystem : public LinearSystem
 {
@@ -153,6 +184,10 @@ public:
   Teuchos::RCP<LinSys::Matrix> getOwnedMatrix() { return ownedMatrix_; }
   Teuchos::RCP<LinSys::MultiVector> getOwnedRhs() { return ownedRhs_; }
 
+  //! Block CRS storage is used for this system (numDof > 1 and block_crs requested)
+  bool useBlockCrs() const { return useBlockCrs_; }
+  Teuchos::RCP<LinSys::BlockMatrix> getOwnedBlockMatrix() { return ownedBlockMatrix_; }
+
   class TpetraLinSysCoeffApplier : public CoeffApplier
   {
   public:
@@ -163,6 +198,7 @@ public:
                              LinSys::LocalVector sharedNotOwnedLclRhs,
                              LinSys::EntityToLIDView entityLIDs,
                              LinSys::EntityToLIDView entityColLIDs,
+                             LinSys::EdgeScatterView edgeToCsrOffset,
                              int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof)
     : ownedLocalMatrix_(ownedLclMatrix),
       sharedNotOwnedLocalMatrix_(sharedNotOwnedLclMatrix),
@@ -170,7 +206,30 @@ public:
       sharedNotOwnedLocalRhs_(sharedNotOwnedLclRhs),
       entityToLID_(entityLIDs),
       entityToColLID_(entityColLIDs),
+      edgeToCsrOffset_(edgeToCsrOffset),
       maxOwnedRowId_(maxOwnedRowId), maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId), numDof_(numDof),
+      useBlockCrs_(false),
+      devicePointer_(nullptr)
+    {}
+
+    KOKKOS_FUNCTION
+    TpetraLinSysCoeffApplier(LinSys::LocalBlockMatrix ownedLclBlockMatrix,
+                             LinSys::LocalBlockMatrix sharedNotOwnedLclBlockMatrix,
+                             LinSys::LocalVector ownedLclRhs,
+                             LinSys::LocalVector sharedNotOwnedLclRhs,
+                             LinSys::EntityToLIDView entityLIDs,
+                             LinSys::EntityToLIDView entityColLIDs,
+                             LinSys::EdgeScatterView edgeToCsrOffset,
+                             int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof)
+    : ownedLocalBlockMatrix_(ownedLclBlockMatrix),
+      sharedNotOwnedLocalBlockMatrix_(sharedNotOwnedLclBlockMatrix),
+      ownedLocalRhs_(ownedLclRhs),
+      sharedNotOwnedLocalRhs_(sharedNotOwnedLclRhs),
+      entityToLID_(entityLIDs),
+      entityToColLID_(entityColLIDs),
+      edgeToCsrOffset_(edgeToCsrOffset),
+      maxOwnedRowId_(maxOwnedRowId), maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId), numDof_(numDof),
+      useBlockCrs_(true),
       devicePointer_(nullptr)
     {}
 
@@ -194,17 +253,29 @@ public:
                             const SharedMemView<const double**,DeviceShmem> & lhs,
                             const char * trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual void sum_into_edge(const stk::mesh::Entity edge,
+                               const ngp::Mesh::ConnectedNodes& entities,
+                               const SharedMemView<int*,DeviceShmem> & localIds,
+                               const SharedMemView<int*,DeviceShmem> & sortPermutation,
+                               const SharedMemView<const double*,DeviceShmem> & rhs,
+                               const SharedMemView<const double**,DeviceShmem> & lhs,
+                               const char * trace_tag);
+
     void free_device_pointer();
 
     sierra::nalu::CoeffApplier* device_pointer();
 
   private:
     LinSys::LocalMatrix ownedLocalMatrix_, sharedNotOwnedLocalMatrix_;
+    LinSys::LocalBlockMatrix ownedLocalBlockMatrix_, sharedNotOwnedLocalBlockMatrix_;
     LinSys::LocalVector ownedLocalRhs_, sharedNotOwnedLocalRhs_;
     LinSys::EntityToLIDView entityToLID_;
     LinSys::EntityToLIDView entityToColLID_;
+    LinSys::EdgeScatterView edgeToCsrOffset_;
     int maxOwnedRowId_, maxSharedNotOwnedRowId_;
     unsigned numDof_;
+    bool useBlockCrs_;
     TpetraLinSysCoeffApplier* devicePointer_;
   };
 
@@ -214,6 +285,24 @@ private:
 
   void beginLinearSystemConstruction();
 
+  /** Precompute where the edges of the edge graph scatter into the matrix
+   *
+   *  Stores, for every locally owned edge, the position of each of its
+   *  (row node, column node) pairs within the matrix row so that the edge
+   *  assembly skips the column sort and search
+   */
+  void build_edge_scatter_map();
+
+  bool find_row_offset(
+    stk::mesh::Entity rowNode,
+    stk::mesh::Entity colNode,
+    LocalOrdinal& offset) const;
+
+  void construct_graphs();
+  void construct_block_graphs(
+    const LocalGraphArrays& ownedGraph,
+    const LocalGraphArrays& sharedNotOwnedGraph);
+
   void checkError( const int /* err_code */, const char * /* msg */) {}
 
   void compute_send_lengths(const std::vector<stk::mesh::Entity>& rowEntities,
@@ -237,6 +326,14 @@ private:
 
   int insert_connection(stk::mesh::Entity a, stk::mesh::Entity b);
   void addConnections(const stk::mesh::Entity* entities,const size_t&);
+
+  // sparsity pattern reuse across reinitializations
+  bool reuse_pattern();
+  void begin_pattern_contribution(const std::string& buildName, const stk::mesh::PartVector& parts);
+  size_t compute_pattern_signature();
+  bool restore_cached_pattern(const size_t signature);
+  void store_pattern(const size_t signature);
+
   void expand_unordered_map(unsigned newCapacityNeeded);
   void checkForNaN(bool useOwned);
   bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
@@ -270,6 +367,20 @@ private:
   Teuchos::RCP<LinSys::Matrix>      sharedNotOwnedMatrix_;
   Teuchos::RCP<LinSys::MultiVector> sharedNotOwnedRhs_;
 
+  // block CRS storage of the matrix; one column index and a dense
+  // numDof x numDof block per node pair. Vectors keep the point maps.
+  bool useBlockCrs_{false};
+  Teuchos::RCP<LinSys::Map>         ownedBlockRowsMap_;
+  Teuchos::RCP<LinSys::Map>         sharedNotOwnedBlockRowsMap_;
+  Teuchos::RCP<LinSys::Map>         totalBlockColsMap_;
+  Teuchos::RCP<LinSys::Graph>       ownedBlockGraph_;
+  Teuchos::RCP<LinSys::Graph>       sharedNotOwnedBlockGraph_;
+  Teuchos::RCP<LinSys::BlockMatrix> ownedBlockMatrix_;
+  Teuchos::RCP<LinSys::BlockMatrix> sharedNotOwnedBlockMatrix_;
+  Teuchos::RCP<LinSys::Export>      blockExporter_;
+  LinSys::LocalBlockMatrix ownedLocalBlockMatrix_;
+  LinSys::LocalBlockMatrix sharedNotOwnedLocalBlockMatrix_;
+
   Teuchos::RCP<LinSys::MultiVector> sln_;
   Teuchos::RCP<LinSys::MultiVector> globalSln_;
   Teuchos::RCP<LinSys::Export>      exporter_;
@@ -281,6 +392,14 @@ private:
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  // parts of the edge graph and the precomputed edge scatter map
+  stk::mesh::PartVector edgeScatterParts_;
+  LinSys::EdgeScatterView edgeToCsrOffset_;
+
+  // order independent hashes of the connectivity added by each graph build call
+  std::vector<std::string> contributionNames_;
+  std::vector<size_t> contributionHashes_;
 };
 
 template<typename T1, typename T2>
@@ -111,6 +111,16 @@ void fill_in_extra_dof_rows_per_node(LocalGraphArrays& csg, int numDof);
 
 void remove_invalid_indices(LocalGraphArrays& csg, LinSys::DeviceRowLengths& rowLengths);
 
+//! Map of the nodes from a map holding numDof consecutive GIDs per node
+Teuchos::RCP<LinSys::Map> make_block_map(const LinSys::Map& pointMap, unsigned numDof);
+
+//! Node graph from the local arrays before the extra dof rows of each node are filled in
+Teuchos::RCP<LinSys::Graph> make_block_graph(const LocalGraphArrays& pointGraph,
+                                             const Teuchos::RCP<const LinSys::Map>& blockRowMap,
+                                             const Teuchos::RCP<const LinSys::Map>& blockColMap,
+                                             const Teuchos::RCP<const LinSys::Map>& blockDomainMap,
+                                             unsigned numDof);
+
 } // nalu
 } // sierra
 
@@ -98,7 +98,8 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
-  void compute_averages(
+  // fused update of the averages and the resolved second/third moments
+  void compute_statistics(
     AveragingInfo* avInfo,
     stk::mesh::Selector sel,
     const double& oldTimeFilter,
@@ -111,27 +112,6 @@ public:
     const std::string &averageBlockName,
     stk::mesh::Selector s_all_nodes);
 
-  void compute_reynolds_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_favre_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_resolved_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
   void compute_sfs_stress(
       const std::string &averageBlockName,
       const double &oldTimeFilter,
@@ -139,13 +119,6 @@ public:
       const double &dt,
       stk::mesh::Selector s_all_nodes);
 
-  void compute_temperature_resolved_flux(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
   void compute_temperature_sfs_flux(
     const std::string &averageBlockName,
     const double &oldTimeFilter,
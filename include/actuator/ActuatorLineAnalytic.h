@@ -0,0 +1,114 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+/** @file ActuatorLineAnalytic.h
+ *  @brief Actuator lines driven by a turbine model that needs no OpenFAST
+ *
+ */
+
+#ifndef ActuatorLineAnalytic_h
+#define ActuatorLineAnalytic_h
+
+#include <actuator/Actuator.h>
+#include <actuator/ActuatorSpreadingStencils.h>
+#include <actuator/TurbineModel.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Actuator line coupled to a TurbineModel
+ *
+ *  Shares the search, ghosting and Gaussian spreading of the OpenFAST actuator
+ *  line, with the turbine supplied through the TurbineModel interface. The
+ *  default model is the AnalyticRotorModel, which prescribes the blade
+ *  geometry, rotation and forces, so the Nalu side of the actuator can be run,
+ *  profiled and tested in builds without OpenFAST. Every step the model is
+ *  advanced to the current time, the points are searched again, the velocity
+ *  is sampled at the points and the point forces are spread onto the mesh.
+ *  The wall time of the search, sampling and spreading phases is accumulated
+ *  separately.
+ */
+class ActuatorLineAnalytic : public Actuator
+{
+public:
+  ActuatorLineAnalytic(Realm& realm, const YAML::Node& node);
+
+  //! Drive the actuator with an externally constructed model
+  ActuatorLineAnalytic(
+    Realm& realm,
+    const YAML::Node& node,
+    std::unique_ptr<TurbineModel> model);
+
+  virtual ~ActuatorLineAnalytic() = default;
+
+  void setup() override;
+
+  void initialize() override;
+
+  void execute() override;
+
+  std::string get_class_name() override;
+
+  //! search the elements around the current point locations and ghost them
+  void update();
+
+  TurbineModel& turbine_model() { return *model_; }
+
+  //! Thrust and torque about the hub of the spread forces, local contribution
+  const std::array<double, 3>& thrust(const int iTurb) const { return thrust_[iTurb]; }
+  const std::array<double, 3>& torque(const int iTurb) const { return torque_[iTurb]; }
+
+  double search_time() const { return timeSearch_; }
+  double sample_time() const { return timeSample_; }
+  double spread_time() const { return timeSpread_; }
+
+private:
+  //! interpolate the velocity to the points and hand it to the model
+  void sample_velocity(
+    const int nDim,
+    const stk::mesh::FieldBase& velocity);
+
+  //! spread the point forces of the model onto the actuator source
+  void spread_forces(
+    const int nDim,
+    const stk::mesh::FieldBase& coordinates,
+    stk::mesh::FieldBase& actuator_source,
+    const stk::mesh::FieldBase& dual_nodal_volume);
+
+  std::unique_ptr<TurbineModel> model_;
+
+  //! Map key to turbine and to point within the turbine
+  std::vector<int> pointTurbine_;
+  std::vector<int> pointIndex_;
+
+  //! Spreading stencils, with the turbine and force of each stencil point
+  ActuatorSpreadingStencils stencils_;
+  std::vector<size_t> stencilTurbine_;
+  std::vector<double> pointForce_;
+
+  std::vector<std::array<double, 3>> thrust_;
+  std::vector<std::array<double, 3>> torque_;
+
+  double timeSearch_{0.0};
+  double timeSample_{0.0};
+  double timeSpread_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <stk_util/parallel/ParallelVectorConcat.hpp>
 #include "ActuatorFAST.h"
+#include "ActuatorSpreadingStencils.h"
 
 // OpenFAST C++ API
 #include "OpenFAST.H"
@@ -45,6 +46,19 @@ public:
     const stk::mesh::FieldBase* dual_nodal_volume) override;
 
   void create_point_info_map_class_specific() override;
+
+private:
+  //! Refresh the per point data after the stencils were rebuilt
+  void build_point_data(const int nDim);
+
+  //! Spreading stencils; rebuilt after each search or mesh motion
+  ActuatorSpreadingStencils stencils_;
+
+  //! Per point data; turbine, Gaussian width, force and orientation
+  std::vector<size_t> pointTurbine_;
+  std::vector<Coordinates> pointEpsilon_;
+  std::vector<double> pointForce_;
+  std::vector<double> pointOrientation_;
 };
 
 } // namespace nalu
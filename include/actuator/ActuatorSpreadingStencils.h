@@ -0,0 +1,157 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+/** @file ActuatorSpreadingStencils.h
+ *  @brief Cached spreading stencils shared by the actuator line types
+ *
+ */
+
+#ifndef ActuatorSpreadingStencils_h
+#define ActuatorSpreadingStencils_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/FieldBase.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class ActuatorPointInfo;
+
+/** Spreading stencils of the local actuator points in CSR form
+ *
+ *  Entries [offsets_[ip], offsets_[ip+1]) hold the nodes of point ip with
+ *  their coordinates, distance to the point and dual volume. The stencils
+ *  are rebuilt after each search (or mesh motion); every step only the
+ *  point forces are refreshed before the scatter.
+ */
+class ActuatorSpreadingStencils
+{
+public:
+  //! Flatten the node sets of the last search into the stencils
+  void build(
+    const int nDim,
+    const std::map<size_t, std::unique_ptr<ActuatorPointInfo>>& pointInfoMap,
+    const stk::mesh::FieldBase& coordinates,
+    const stk::mesh::FieldBase& dual_nodal_volume);
+
+  //! Mark the stencils stale, e.g., after the points were searched again
+  void invalidate() { current_ = false; }
+
+  bool current() const { return current_; }
+
+  size_t num_points() const { return pointIds_.size(); }
+
+  //! Key in the point info map of point ip
+  size_t point_id(const size_t ip) const { return pointIds_[ip]; }
+
+  /** Spread the point forces onto the actuator source in one pass
+   *
+   *  weight(ip, distance) returns the Gaussian weight of a stencil node of
+   *  point ip at the given distance from the point. pointForce holds nDim
+   *  values and pointTurbine the turbine of each point; hubPos and
+   *  hubShftDir hold three values per turbine. The thrust and torque about
+   *  the hub of the spread forces are added to thr and tor, three values
+   *  per turbine. Nodes shared by points are summed atomically.
+   */
+  template <typename WeightFunction>
+  void spread(
+    const int nDim,
+    const WeightFunction& weight,
+    const std::vector<double>& pointForce,
+    const std::vector<size_t>& pointTurbine,
+    const std::vector<double>& hubPos,
+    const std::vector<double>& hubShftDir,
+    stk::mesh::FieldBase& actuator_source,
+    std::vector<double>& thr,
+    std::vector<double>& tor) const;
+
+private:
+  std::vector<size_t> pointIds_;
+  std::vector<size_t> offsets_;
+  std::vector<stk::mesh::Entity> nodes_;
+  std::vector<double> coords_;
+  std::vector<double> distance_;
+  std::vector<double> volume_;
+
+  bool current_{false};
+};
+
+template <typename WeightFunction>
+void
+ActuatorSpreadingStencils::spread(
+  const int nDim,
+  const WeightFunction& weight,
+  const std::vector<double>& pointForce,
+  const std::vector<size_t>& pointTurbine,
+  const std::vector<double>& hubPos,
+  const std::vector<double>& hubShftDir,
+  stk::mesh::FieldBase& actuator_source,
+  std::vector<double>& thr,
+  std::vector<double>& tor) const
+{
+  Kokkos::parallel_for(
+    "ActuatorSpreadingStencils::spread",
+    Kokkos::RangePolicy<HostSpace>(0, num_points()),
+    [&](const size_t ip) {
+      const double* force = &pointForce[ip * nDim];
+      const size_t iTurb = pointTurbine[ip];
+      const double* hubPt = &hubPos[3 * iTurb];
+      const double* hubShft = &hubShftDir[3 * iTurb];
+
+      double nodeForce[3] = {0.0, 0.0, 0.0};
+      double thrPoint[3] = {0.0, 0.0, 0.0};
+      double torPoint[3] = {0.0, 0.0, 0.0};
+
+      for (size_t k = offsets_[ip]; k < offsets_[ip + 1]; ++k) {
+        const double gA = weight(ip, &distance_[k * nDim]);
+
+        double* sourceTerm =
+          (double*)stk::mesh::field_data(actuator_source, nodes_[k]);
+        for (int j = 0; j < nDim; ++j) {
+          nodeForce[j] = force[j] * gA;
+          Kokkos::atomic_add(&sourceTerm[j], nodeForce[j]);
+        }
+
+        // thrust and torque contribution of this node
+        const double* nodeCoords = &coords_[k * nDim];
+        const double dVol = volume_[k];
+        double r[3] = {0.0, 0.0, 0.0};
+        double rDotHubShftVec = 0.0;
+        for (int j = 0; j < nDim; ++j) {
+          r[j] = nodeCoords[j] - hubPt[j];
+          rDotHubShftVec += r[j] * hubShft[j];
+        }
+        for (int j = 0; j < nDim; ++j)
+          r[j] -= rDotHubShftVec * hubShft[j];
+
+        for (int j = 0; j < nDim; ++j)
+          thrPoint[j] += nodeForce[j] * dVol;
+        torPoint[0] += (r[1] * nodeForce[2] - r[2] * nodeForce[1]) * dVol;
+        torPoint[1] += (r[2] * nodeForce[0] - r[0] * nodeForce[2]) * dVol;
+        torPoint[2] += (r[0] * nodeForce[1] - r[1] * nodeForce[0]) * dVol;
+      }
+
+      for (int j = 0; j < 3; ++j) {
+        Kokkos::atomic_add(&thr[3 * iTurb + j], thrPoint[j]);
+        Kokkos::atomic_add(&tor[3 * iTurb + j], torPoint[j]);
+      }
+    });
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
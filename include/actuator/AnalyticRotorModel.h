@@ -0,0 +1,103 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef AnalyticRotorModel_h
+#define AnalyticRotorModel_h
+
+#include <actuator/TurbineModel.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Prescribed rotor used in place of OpenFAST
+ *
+ *  Each turbine is a rigid rotor of straight blades turning at a constant
+ *  speed about a fixed shaft. The blade points are spaced uniformly between
+ *  the hub and tip radius and carry a constant share of the prescribed thrust
+ *  and torque, so that the point forces push the fluid against the shaft
+ *  direction and turn it against the rotation. The shaft direction points
+ *  downwind and the rotor turns counterclockwise about it. Turbines are dealt
+ *  out to the ranks round robin. The sampled velocity is stored but does not
+ *  feed back on the forces.
+ */
+class AnalyticRotorModel : public TurbineModel
+{
+public:
+  AnalyticRotorModel(const YAML::Node& node, const int numProcs);
+
+  virtual ~AnalyticRotorModel() {}
+
+  // load the turbines from the actuator block
+  void load(const YAML::Node& y_actuator);
+
+  int num_turbines() const override { return rotors_.size(); }
+
+  int turbine_proc(const int iTurb) const override;
+
+  int num_points(const int iTurb) const override;
+
+  Coordinates epsilon(const int iTurb) const override;
+
+  void point_coordinates(
+    const int iTurb, const int ip, double* coords) const override;
+
+  void point_force(
+    const int iTurb, const int ip, double* force) const override;
+
+  void set_point_velocity(
+    const int iTurb, const int ip, const double* velocity) override;
+
+  void hub_position(const int iTurb, double* position) const override;
+
+  void shaft_direction(const int iTurb, double* direction) const override;
+
+  void advance(const double time) override;
+
+  //! Velocity last sampled at the point
+  const double* point_velocity(const int iTurb, const int ip) const;
+
+private:
+  struct Rotor
+  {
+    std::string name_;
+    std::array<double, 3> hub_{{0.0, 0.0, 0.0}};
+    // unit shaft direction and two unit vectors spanning the rotor plane
+    std::array<double, 3> shaft_{{1.0, 0.0, 0.0}};
+    std::array<double, 3> e1_{{0.0, 1.0, 0.0}};
+    std::array<double, 3> e2_{{0.0, 0.0, 1.0}};
+    double rotorRadius_{1.0};
+    double hubRadius_{0.0};
+    int numBlades_{3};
+    int numPointsPerBlade_{10};
+    double omega_{0.0};
+    double thrust_{0.0};
+    double torque_{0.0};
+    double azimuth0_{0.0};
+    double azimuth_{0.0};
+    Coordinates epsilon_;
+    std::vector<double> velocity_;
+  };
+
+  // radius and blade azimuth of a point
+  void point_location(
+    const Rotor& rotor, const int ip, double& radius, double& azimuth) const;
+
+  const int numProcs_;
+  std::vector<Rotor> rotors_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef TurbineModel_h
+#define TurbineModel_h
+
+#include <NaluParsing.h>
+
+namespace sierra {
+namespace nalu {
+
+/** Interface between the actuator machinery and a turbine model
+ *
+ *  The actuator samples the velocity at the points of every turbine owned by
+ *  this rank, advances the model to the current time and spreads the point
+ *  forces back onto the mesh. A model only answers for the turbines whose
+ *  turbine_proc() is the calling rank.
+ */
+class TurbineModel
+{
+public:
+  virtual ~TurbineModel() {}
+
+  virtual int num_turbines() const = 0;
+
+  //! Rank that owns the actuator points of the turbine
+  virtual int turbine_proc(const int iTurb) const = 0;
+
+  virtual int num_points(const int iTurb) const = 0;
+
+  //! Gaussian spreading width of the turbine points
+  virtual Coordinates epsilon(const int iTurb) const = 0;
+
+  virtual void point_coordinates(
+    const int iTurb, const int ip, double* coords) const = 0;
+
+  //! Force exerted by the point on the fluid
+  virtual void point_force(
+    const int iTurb, const int ip, double* force) const = 0;
+
+  //! Fluid velocity sampled at the point for the next advance
+  virtual void set_point_velocity(
+    const int iTurb, const int ip, const double* velocity) = 0;
+
+  virtual void hub_position(const int iTurb, double* position) const = 0;
+
+  virtual void shaft_direction(const int iTurb, double* direction) const = 0;
+
+  //! Advance the model to the given time
+  virtual void advance(const double time) = 0;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
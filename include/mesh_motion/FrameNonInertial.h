@@ -2,6 +2,10 @@
 #define FRAMENONINERTIAL_H
 
 #include "FrameBase.h"
+#include "mesh_motion/NgpMotion.h"
+
+#include <KokkosInterface.h>
+#include <ngp_utils/NgpMeshInfo.h>
 
 #include "yaml-cpp/yaml.h"
 
@@ -27,19 +31,42 @@ public:
 
   void update_coordinates_velocity(const double time);
 
+  /** Update the nodes of this frame in the device fields of meshInfo
+   *
+   *  Frames sharing meshInfo write to the same device fields; the host
+   *  copies are left alone until sync_to_host
+   */
+  void update_coordinates_velocity(
+    const double time,
+    const nalu_ngp::MeshInfo<>& meshInfo);
+
+  //! Copy the updated coordinates, displacement and mesh velocity to host
+  static void sync_to_host(const nalu_ngp::MeshInfo<>& meshInfo);
+
   void post_compute_geometry();
 
 private:
   FrameNonInertial() = delete;
   FrameNonInertial(const FrameNonInertial&) = delete;
 
-  /** Compute transformation matrix
+  using NgpMotionView = Kokkos::View<NgpMotion*, Kokkos::LayoutRight, MemSpace>;
+
+  /** Gather the motion parameters at the current time on device
    *
-   * @return 4x4 matrix representing composite addition of motions
+   * @return true if every motion is rigid and the composite transformation
+   *         is the same for all nodes of the frame
    */
-  MotionBase::TransMatType compute_transformation(
-    const double,
-    const double*);
+  bool gather_motions(const double time);
+
+  /** Composite transformation of the rigid motions
+   *
+   * All non-inertial frame motions are based off of the reference frame
+   */
+  NgpTransMat compute_transformation() const;
+
+  //! Motion parameters on device and their host mirror
+  NgpMotionView motions_;
+  NgpMotionView::HostMirror motionsHost_;
 };
 
 } // nalu
@@ -2,6 +2,11 @@
 #define MESHMOTIONALG_H
 
 #include "FrameBase.h"
+#include "FrameNonInertial.h"
+
+#include <ngp_utils/NgpMeshInfo.h>
+
+#include <memory>
 
 namespace sierra{
 namespace nalu{
@@ -33,6 +38,12 @@ private:
 
   void compute_set_centroid();
 
+  //! NGP mesh and fields shared by the frames, rebuilt after mesh modifications
+  const nalu_ngp::MeshInfo<>& mesh_info();
+
+  //! Reference to the STK Mesh BulkData object
+  stk::mesh::BulkData& bulk_;
+
   /** Motion frame vector
    *
    *  Vector of type of frame of corresponding motion
@@ -47,6 +58,12 @@ private:
    */
   std::map<int, std::shared_ptr<FrameBase>> refFrameMap_;
 
+  //! Non-inertial frames, updated on device every time step
+  std::vector<std::shared_ptr<FrameNonInertial>> nonInertialFrames_;
+
+  std::unique_ptr<nalu_ngp::MeshInfo<>> meshInfo_;
+  size_t meshModCount_{0};
+
   //! flag to guard against multiple invocations of initialize()
   bool isInit_ = false;
 };
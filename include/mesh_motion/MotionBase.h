@@ -2,6 +2,7 @@
 #define MOTIONBASE_H
 
 #include <FieldTypeDef.h>
+#include <mesh_motion/NgpMotion.h>
 
 #include "yaml-cpp/yaml.h"
 
@@ -47,6 +48,19 @@ public:
     const double* mxyz,
     const double* cxyz ) = 0;
 
+  /** Function to gather the motion parameters used on device
+   *
+   * The default copies the transformation matrix built at the current
+   * time with no velocity; motions with a mesh velocity or a transformation
+   * that varies from node to node override it
+   *
+   * @param[in]  time   Current time
+   * @param[out] motion Transformation and velocity parameters of the motion
+   */
+  virtual void ngp_motion(
+    const double time,
+    NgpMotion& motion);
+
   /** Composite addition of motions
    *
    * @param[in] motionL Left matrix in composite transformation of matrices
@@ -33,6 +33,15 @@ public:
     const double* mxyz,
     const double* cxyz );
 
+  /** Function to gather the motion parameters used on device
+   *
+   * @param[in]  time   Current time
+   * @param[out] motion Transformation and velocity parameters of the motion
+   */
+  virtual void ngp_motion(
+    const double time,
+    NgpMotion& motion);
+
   /** perform post compute geometry work for this motion
    *
    * @param[in] computedMeshVelDiv flag to denote if divergence of
@@ -31,6 +31,15 @@ public:
     const double* mxyz,
     const double* cxyz );
 
+  /** Function to gather the motion parameters used on device
+   *
+   * @param[in]  time   Current time
+   * @param[out] motion Transformation and velocity parameters of the motion
+   */
+  virtual void ngp_motion(
+    const double time,
+    NgpMotion& motion);
+
 private:
   MotionTranslation() = delete;
   MotionTranslation(const MotionTranslation&) = delete;
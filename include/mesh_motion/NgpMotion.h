@@ -0,0 +1,150 @@
+#ifndef NGPMOTION_H
+#define NGPMOTION_H
+
+#include <KokkosInterface.h>
+
+#include <cmath>
+
+namespace sierra{
+namespace nalu{
+
+/** Parameters of one motion at the current time, evaluated on device
+ *
+ *  A motion is either rigid, one transformation for every node of the frame,
+ *  or a uniform scaling about its origin that grows the distance of the model
+ *  coordinates to the origin by radialDelta (the pulsating sphere). The mesh
+ *  velocity of the motion is
+ *
+ *    omega x (cxyz - C origin) + rate (mxyz - C origin) + velocity
+ *      + radialSpeed (mxyz - origin) / |mxyz - origin|
+ *
+ *  with C the composite transformation of the node, which reproduces the
+ *  compute_velocity() of every motion type.
+ */
+struct NgpMotion
+{
+  //! Rigid transformation; the last row of the 4x4 matrix is implied
+  double transMat[3][4] = {{1.0, 0.0, 0.0, 0.0},
+                           {0.0, 1.0, 0.0, 0.0},
+                           {0.0, 0.0, 1.0, 0.0}};
+
+  double origin[3] = {0.0, 0.0, 0.0};
+  double omega[3] = {0.0, 0.0, 0.0};
+  double rate[3] = {0.0, 0.0, 0.0};
+  double velocity[3] = {0.0, 0.0, 0.0};
+
+  bool isRadial{false};
+  double radialDelta{0.0};
+  double radialSpeed{0.0};
+};
+
+//! Affine transformation with the implied last row (0,0,0,1)
+struct NgpTransMat
+{
+  double mat[3][4] = {{1.0, 0.0, 0.0, 0.0},
+                      {0.0, 1.0, 0.0, 0.0},
+                      {0.0, 0.0, 1.0, 0.0}};
+};
+
+namespace ngp_motion {
+
+//! C = L R, as MotionBase::add_motion
+KOKKOS_INLINE_FUNCTION
+void compose(
+  const double L[3][4],
+  const double R[3][4],
+  double C[3][4])
+{
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 4; ++c) {
+      double sum = (c == 3) ? L[r][3] : 0.0;
+      for (int k = 0; k < 3; ++k)
+        sum += L[r][k] * R[k][c];
+      C[r][c] = sum;
+    }
+  }
+}
+
+//! y = T x for a point x
+KOKKOS_INLINE_FUNCTION
+void apply(const double T[3][4], const double* x, double* y)
+{
+  for (int d = 0; d < 3; ++d)
+    y[d] = T[d][0]*x[0] + T[d][1]*x[1] + T[d][2]*x[2] + T[d][3];
+}
+
+//! Transformation of the motion at the model coordinates mxyz
+KOKKOS_INLINE_FUNCTION
+void transformation(
+  const NgpMotion& mm,
+  const double* mxyz,
+  double T[3][4])
+{
+  if (!mm.isRadial) {
+    for (int r = 0; r < 3; ++r)
+      for (int c = 0; c < 4; ++c)
+        T[r][c] = mm.transMat[r][c];
+    return;
+  }
+
+  // uniform scaling about the origin, as MotionPulsatingSphere::scaling_mat
+  double radius = 0.0;
+  for (int d = 0; d < 3; ++d)
+    radius += (mxyz[d] - mm.origin[d]) * (mxyz[d] - mm.origin[d]);
+  radius = std::sqrt(radius);
+
+  const double scaling =
+    (radius == 0.0) ? 1.0 : (radius + mm.radialDelta) / radius;
+
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c)
+      T[r][c] = (r == c) ? scaling : 0.0;
+    T[r][3] = (1.0 - scaling) * mm.origin[r];
+  }
+}
+
+//! Add the velocity of the motion at a node with composite transformation C
+KOKKOS_INLINE_FUNCTION
+void add_velocity(
+  const NgpMotion& mm,
+  const double C[3][4],
+  const double* mxyz,
+  const double* cxyz,
+  double* vel)
+{
+  double transOrigin[3];
+  apply(C, mm.origin, transOrigin);
+
+  double relCoord[3], relModel[3];
+  for (int d = 0; d < 3; ++d) {
+    relCoord[d] = cxyz[d] - transOrigin[d];
+    relModel[d] = mxyz[d] - transOrigin[d];
+  }
+
+  vel[0] += mm.omega[1]*relCoord[2] - mm.omega[2]*relCoord[1];
+  vel[1] += mm.omega[2]*relCoord[0] - mm.omega[0]*relCoord[2];
+  vel[2] += mm.omega[0]*relCoord[1] - mm.omega[1]*relCoord[0];
+
+  for (int d = 0; d < 3; ++d)
+    vel[d] += mm.rate[d]*relModel[d] + mm.velocity[d];
+
+  if (mm.isRadial) {
+    double radius = 0.0;
+    for (int d = 0; d < 3; ++d)
+      radius += (mxyz[d] - mm.origin[d]) * (mxyz[d] - mm.origin[d]);
+    radius = std::sqrt(radius);
+
+    if (radius > 0.0) {
+      const double fac = mm.radialSpeed / radius;
+      for (int d = 0; d < 3; ++d)
+        vel[d] += fac * (mxyz[d] - mm.origin[d]);
+    }
+  }
+}
+
+} // ngp_motion
+
+} // nalu
+} // sierra
+
+#endif /* NGPMOTION_H */
@@ -31,6 +31,9 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "field_update_" + fieldName_; }
+
 private:
   //! Field that is synchronized pre/post updates
   const std::string fieldName_;
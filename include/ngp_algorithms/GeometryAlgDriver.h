@@ -52,6 +52,17 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "geometry"; }
+
+  virtual bool overlaps_post_work() const override { return true; }
+
+  //! Start the sums of the shared volumes, areas and wall data
+  virtual void begin_post_work() override;
+
+  //! Complete the sums, the periodic updates and the wall normalization
+  virtual void end_post_work() override;
+
   /** Register wall function geometry calculation algorithm
    *
    *  Need a specialization here to track whether the user has requested wall functions
@@ -70,6 +81,11 @@ public:
   }
 
 private:
+  //! Assembled fields that are summed over the shared entities
+  std::vector<NGPDoubleFieldType*> summed_fields();
+
+  void complete_post_work(const std::vector<NGPDoubleFieldType*>& fields);
+
   //! Flag to track whether wall functions are active
   bool hasWallFunc_{false};
 };
@@ -32,6 +32,9 @@ public:
   //! Perform mdot correction logic after algorithms have done their work
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "mdot"; }
+
   //! Add up density accumulation from different topo element algorithms
   void add_density_accumulation(const DoubleType&);
 
@@ -21,6 +21,7 @@
 #include "Enums.h"
 #include "nalu_make_unique.h"
 #include "NaluEnv.h"
+#include "ParallelSumPlan.h"
 #include "ngp_utils/NgpCreateElemInstance.h"
 
 namespace sierra {
@@ -43,9 +44,25 @@ public:
 
   /** Execute all the algorithms registered to this driver
    *
+   *  With overlapped parallel assembly and a driver that overlaps its
+   *  post_work, the entities touching shared nodes are assembled first,
+   *  the sums of the shared contributions are started, the interior
+   *  entities are assembled and the sums are completed.
    */
   virtual void execute();
 
+  //! True if begin_post_work and end_post_work split the post_work
+  virtual bool overlaps_post_work() const { return false; }
+
+  //! Name of the driver under which pre_work and post_work are timed
+  virtual std::string timer_name() const { return "driver"; }
+
+  //! Start the parallel updates once the interface entities are assembled
+  virtual void begin_post_work() {}
+
+  //! Complete the parallel updates once the interior entities are assembled
+  virtual void end_post_work() { post_work(); }
+
   /** Register an edge algorithm
    *
    *  Currently only interior algorithms can be edge algorithms
@@ -198,9 +215,20 @@ protected:
                           std::string entityType,
                           std::string algName);
 
+  //! Run one registered algorithm, accumulating its time
+  void run_algorithm(const std::string& algName, Algorithm& alg);
+
+  //! Database path of the given phase (pre_work/post_work) of this driver
+  std::string work_timer_name(const std::string& phase) const;
+
+  //! Sum plan of the shared entities, rebuilt after mesh modifications
+  ParallelSumPlan& parallel_sum_plan();
+
   //! Algorithms registered
   std::map<std::string, std::unique_ptr<Algorithm>> algMap_;
 
+  ParallelSumPlan sumPlan_;
+
   Realm& realm_;
 };
 
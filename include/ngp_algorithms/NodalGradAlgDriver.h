@@ -36,7 +36,21 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "nodal_grad_" + gradPhiName_; }
+
+  virtual bool overlaps_post_work() const override { return true; }
+
+  //! Start the sum of the shared gradients
+  virtual void begin_post_work() override;
+
+  //! Complete the sum and the periodic/overset updates
+  virtual void end_post_work() override;
+
 private:
+  //! Periodic and overset updates and the final sync to device
+  void complete_post_work();
+
   //! Field that is synchronized pre/post updates
   const std::string gradPhiName_;
 };
@@ -35,6 +35,9 @@ public:
   virtual void pre_work() override;
 
   virtual void post_work() override;
+
+  virtual std::string timer_name() const override
+  { return "sdr_wall_func"; }
 };
 
 }  // nalu
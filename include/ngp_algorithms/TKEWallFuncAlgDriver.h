@@ -41,6 +41,9 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "tke_wall_func"; }
+
 private:
   unsigned tke_ {stk::mesh::InvalidOrdinal};
   unsigned bctke_ {stk::mesh::InvalidOrdinal};
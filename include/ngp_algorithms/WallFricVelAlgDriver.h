@@ -41,6 +41,9 @@ public:
   //! Perform global integration of utau and update ABL statistics instance
   virtual void post_work() override;
 
+  virtual std::string timer_name() const override
+  { return "wall_fric_vel"; }
+
   /** Accumulate partial sum from topology-specific element algorithms
    *
    *  @param utau_area_sum Partial sum of (utau * area) over the integration points
@@ -46,8 +46,9 @@ struct SimpleNodeFieldOp
   KOKKOS_INLINE_FUNCTION
   SimpleNodeFieldOp(
     const Mesh& ngpMesh,
-    const Field& ngpField)
-    : ngpMesh_(ngpMesh), ngpField_(ngpField)
+    const Field& ngpField,
+    const bool atomicFree = false)
+    : ngpMesh_(ngpMesh), ngpField_(ngpField), atomicFree_(atomicFree)
   {}
 
   KOKKOS_FUNCTION ~SimpleNodeFieldOp() = default;
@@ -76,7 +77,10 @@ struct SimpleNodeFieldOp
       const auto& msh = obj_.ngpMesh_;
       const auto& fld = obj_.ngpField_;
       const auto& nodes = einfo_.entityNodes;
-      Kokkos::atomic_add(&fld.get(msh, nodes[ni], ic), val);
+      if (obj_.atomicFree_)
+        fld.get(msh, nodes[ni], ic) += val;
+      else
+        Kokkos::atomic_add(&fld.get(msh, nodes[ni], ic), val);
     }
 
     KOKKOS_INLINE_FUNCTION
@@ -111,6 +115,9 @@ struct SimpleNodeFieldOp
   const Mesh ngpMesh_;
 
   const Field ngpField_;
+
+  //! Plain stores in loops over node-disjoint entities, see EntityColoring
+  const bool atomicFree_;
 };
 
 /** Update an NGP field registered on NODE_RANK with SIMD right hand sides.
@@ -421,10 +428,10 @@ template<typename Mesh, typename Field>
 KOKKOS_INLINE_FUNCTION
 impl::SimpleNodeFieldOp<Mesh, Field>
 edge_nodal_field_updater(
-  const Mesh& mesh, const Field& fld)
+  const Mesh& mesh, const Field& fld, const bool atomicFree = false)
 {
   NGP_ThrowAssert(fld.get_rank() == stk::topology::NODE_RANK);
-  return impl::SimpleNodeFieldOp<Mesh, Field>{mesh, fld};
+  return impl::SimpleNodeFieldOp<Mesh, Field>{mesh, fld, atomicFree};
 }
 
 }  // nalu_ngp
@@ -271,6 +271,64 @@ inline void run_edge_algorithm(
   });
 }
 
+/** Execute the given functor for the entities of a coloring, one color at a time
+ *
+ *  Entities of the same color share no nodes, so the functor may accumulate
+ *  into nodal quantities without atomics. The functor is called with one
+ *  argument MeshIndex as in run_entity_algorithm.
+ *
+ *. @param algName User-defined name for the parallel loops
+ *  @param mesh A STK NGP mesh instance
+ *  @param coloring Colors of the entities to visit, see EntityColoring
+ *  @param algorithm A functor that will be executed for each entity
+ */
+template<typename Mesh, typename Coloring, typename AlgFunctor>
+void run_colored_entity_algorithm(
+  const std::string& algName,
+  const Mesh& mesh,
+  const Coloring& coloring,
+  const AlgFunctor algorithm)
+{
+  using Traits    = NGPMeshTraits<Mesh>;
+  using MeshIndex = typename Traits::MeshIndex;
+
+  const stk::topology::rank_t rank = coloring.rank();
+  for (int c = 0; c < coloring.num_colors(); ++c) {
+    const auto entities = coloring.color_entities(c);
+    Kokkos::parallel_for(
+      algName, Kokkos::RangePolicy<DeviceSpace>(0, entities.extent(0)),
+      KOKKOS_LAMBDA(const size_t& k) {
+        const auto& idx = entities(k);
+        MeshIndex meshIdx{&mesh.get_bucket(rank, idx.bucket_id), idx.bucket_ord};
+        algorithm(meshIdx);
+      });
+  }
+}
+
+/** Execute the given functor for the edges of a coloring, one color at a time
+ *
+ *  See run_colored_entity_algorithm; the functor is called with an EntityInfo
+ *  as in run_edge_algorithm.
+ */
+template<typename Mesh, typename Coloring, typename AlgFunctor>
+inline void run_colored_edge_algorithm(
+  const std::string& algName,
+  const Mesh& mesh,
+  const Coloring& coloring,
+  const AlgFunctor algorithm)
+{
+  using Traits    = NGPMeshTraits<Mesh>;
+  using MeshIndex = typename Traits::MeshIndex;
+
+  run_colored_entity_algorithm(
+    algName, mesh, coloring,
+    KOKKOS_LAMBDA(MeshIndex& meshIdx) {
+      algorithm(
+        EntityInfo<Mesh>{meshIdx, (*meshIdx.bucket)[meshIdx.bucketOrd],
+            mesh.get_nodes(meshIdx)});
+  });
+}
+
 /** Execute the given functor for all elements in a Kokkos parallel loop
  *
  *  The functor is called with one argument MeshIndex, a struct containing a
@@ -39,7 +39,8 @@ public:
       const bool activateScattering,
       const bool activateUpwind,
       const bool deactivateSucv,
-      const bool externalCoupling);
+      const bool externalCoupling,
+      const int ordinateBatchSize = 1);
   virtual ~RadiativeTransportEquationSystem();
   
   void register_nodal_fields(
@@ -111,6 +112,9 @@ public:
   const bool activateUpwind_;
   const bool deactivateSucv_;
   const bool externalCoupling_;
+
+  // ordinates within a batch share one preconditioner setup
+  const int ordinateBatchSize_;
   
   ScalarFieldType *intensity_;
   ScalarFieldType *currentIntensity_;
@@ -66,6 +66,9 @@ public:
   std::vector<double *> workIndVar_;
   std::vector<double> workZ_;
 
+  // scratch space for the batched table query
+  HDF5TableWorkspace workspace_;
+
   /** execute Algorithm */
   virtual void execute();
 
@@ -8,6 +8,35 @@ namespace nalu {
 
 // Forward declarations
 class H5IO;
+class BSpline1D;
+
+//====================================================================
+
+/**
+ *  @struct BSplineWorkspace
+ *  @brief  Caller-owned scratch space for batched spline evaluation
+ *
+ *  Holds the knot spans and basis functions of a batch of points for each
+ *  dimension, so that a batched evaluation does not touch any member of
+ *  the spline.  One workspace per calling thread; the buffers grow to the
+ *  largest batch seen.
+ */
+struct BSplineWorkspace
+{
+  struct Axis
+  {
+    std::vector<int> span;      // knot span for each point
+    std::vector<double> basis;  // [order+1][npts]
+  };
+  Axis axis[5];
+
+  // first control point and term weight for each point
+  std::vector<int> start;
+  std::vector<double> weight;
+
+  // transient scratch for the 1-D basis evaluation
+  std::vector<double> uk, left, right, saved;
+};
 
 //====================================================================
 //====================================================================
@@ -55,6 +84,17 @@ class BSpline{
 
   double value( std::vector<double> & x ) const{ return value( &x[0] ); }
 
+  /**
+   *  Append the control points of this spline, ordered with the first
+   *  dimension varying slowest, and record the 1-D spline describing each
+   *  dimension starting at axes[axis].  Returns false if the lower
+   *  dimension splines do not share their knot vectors, in which case the
+   *  spline has no dense tensor form.
+   */
+  virtual bool append_tensor( const int axis,
+                              std::vector<const BSpline1D*> & axes,
+                              std::vector<double> & controlPts ) const = 0;
+
   /**
    *  Read a spline from an HDF5 database.  The file should be opened
    *  and an hdf5 "group" specified.  This spline will be read from the
@@ -132,6 +172,15 @@ class BSpline1D : public BSpline{
   double value( const double* indepVar ) const;
   inline double value( const double & x ) const{ return value(&x); }
 
+  bool append_tensor( const int axis, std::vector<const BSpline1D*> & axes, std::vector<double> & controlPts ) const;
+
+  /**
+   *  Knot span and basis functions for each of npts points; basis is
+   *  stored as [order+1][npts] so that the recursion vectorizes over the
+   *  points.  Only the transient scratch of ws is used.
+   */
+  void basis( const int npts, const double* x, int* span, double* basis, BSplineWorkspace & ws ) const;
+
   inline const std::vector<double> & get_control_pts() const{ return controlPts_; }
   inline       std::vector<double> & get_control_pts()      { return controlPts_; }
   inline const std::vector<double> & get_knot_vector() const{ return knots_; };
@@ -232,6 +281,7 @@ class BSpline2D : public BSpline{
    *  given value of the dependent variable.  Ordering is [x1,x2]
    */
   double value( const double* indepVar ) const;
+  bool append_tensor( const int axis, std::vector<const BSpline1D*> & axes, std::vector<double> & controlPts ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -316,6 +366,7 @@ class BSpline3D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3].
    */
   double value( const double* ) const;
+  bool append_tensor( const int axis, std::vector<const BSpline1D*> & axes, std::vector<double> & controlPts ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -404,6 +455,7 @@ class BSpline4D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3,x4].
    */
   double value( const double* x ) const;
+  bool append_tensor( const int axis, std::vector<const BSpline1D*> & axes, std::vector<double> & controlPts ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -495,6 +547,7 @@ class BSpline5D : public BSpline{
    *  the independent variables.  Ordering is [x1,x2,x3,x4,x5].
    */
   double value( const double* x ) const;
+  bool append_tensor( const int axis, std::vector<const BSpline1D*> & axes, std::vector<double> & controlPts ) const;
 
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
@@ -530,6 +583,51 @@ class BSpline5D : public BSpline{
 //====================================================================
 //====================================================================
 
+/**
+ *  @class  BSplineTensor
+ *  @brief  Dense tensor-product form of a BSpline for batched evaluation
+ *
+ *  The recursive splines store one lower-dimension spline per control
+ *  point of the first dimension and evaluate them point by point.  When
+ *  all of them share their knot vectors (always the case for splines fit
+ *  to a structured table), the control points form a dense tensor.  The
+ *  knot spans and basis functions are then computed once per dimension
+ *  for a whole batch, and the tensor contraction runs across the points.
+ */
+class BSplineTensor{
+ public:
+
+  /** Build the dense form; valid() is false if the spline has none */
+  explicit BSplineTensor( const BSpline & spline );
+
+  bool valid() const{ return valid_; }
+
+  int get_dimension() const{ return (int)axes_.size(); }
+
+  /**
+   *  Evaluate the spline at npts points; x holds one array per dimension.
+   *  Thread safe with distinct workspaces.
+   */
+  void values( const int npts,
+               const double* const* x,
+               double* result,
+               BSplineWorkspace & ws ) const;
+
+ private:
+
+  bool valid_;
+  std::vector<const BSpline1D*> axes_;  // owned by the source spline
+  std::vector<double> controlPts_;      // first dimension varies slowest
+  std::vector<int> stride_;             // control point stride per dimension
+
+  // for each term of the contraction: basis index per dimension, offset
+  std::vector<int> termIndex_;          // [nterms][dim]
+  std::vector<int> termOffset_;
+};
+
+//====================================================================
+//====================================================================
+
 } // end nalu namespace
 } // end sierra namespace
 
@@ -3,6 +3,7 @@
 
 #include <hdf5.h>
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -104,8 +105,13 @@ class H5IO {
 
   void write_dataset( const std::string & name,
                       const std::vector<double> & value );
+  void create_dataset( const std::string & name, std::size_t size );
+  void write_dataset( const std::string & name, std::size_t offset,
+                      const std::vector<double> & value );
 
   void read_dataset( const std::string & name, std::vector<double> & value );
+  void read_dataset( const std::string & name, std::size_t offset,
+                     std::size_t count, std::vector<double> & value );
 
  private:
   void h5io_create_group( const std::string & name ); 
@@ -113,7 +119,7 @@ class H5IO {
   void h5io_open_group(); 
   void h5io_close_group(); 
   hid_t h5io_create_scalar();
-  hid_t h5io_create_1D_array( unsigned int size );
+  hid_t h5io_create_1D_array( std::size_t size );
   hid_t h5io_create_attribute( const std::string & name,
                                hid_t type,
                                hid_t space );
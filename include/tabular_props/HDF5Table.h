@@ -7,6 +7,7 @@
 #include <map>
 
 #include "tabular_props/H5IO.h"
+#include "tabular_props/BSpline.h"
 
 namespace sierra {
 namespace nalu {
@@ -15,7 +16,6 @@ namespace nalu {
 //class Realm;
 class Converter;
 class H5IO;
-class BSpline;
 
 struct ClipEvent {
   double severity;
@@ -34,6 +34,23 @@ class ClipEventSortCriterion {
 
 typedef std::set<ClipEvent, ClipEventSortCriterion<ClipEvent> > ClipEventLog;
 
+/**
+ *  @struct HDF5TableWorkspace
+ *  @brief  Scratch space and clipping diagnostics for batched queries
+ *
+ *  One workspace per calling thread.  Clipping events are gathered here
+ *  and folded into the table with HDF5Table::merge_clipping().
+ */
+struct HDF5TableWorkspace {
+  std::vector<std::vector<double> > tableInputs;
+  std::vector<const double *> tableInputPtrs;
+  std::vector<double> converterBuf;
+  std::vector<double> clipValues;
+  BSplineWorkspace spline;
+  unsigned int numClipped{0};
+  ClipEventLog clipEventLog;
+};
+
 /**
  *  @class  HDF5Table
  *  @brief  Object to manage property evaluation as a function of a set of
@@ -106,6 +123,32 @@ class HDF5Table
    */
   double raw_query( const std::vector<double> &inputs ) const;
 
+  /**
+   *  Batched form of query() for npts points; inputs holds one array per
+   *  input variable, in the order of input_names().  The knot spans and
+   *  basis functions are evaluated once per table dimension for the whole
+   *  batch.  Concurrent calls with distinct workspaces are safe only when
+   *  has_tensor_form() is true and the table has no converters: the
+   *  fallback for a spline without a dense form, and the converters, use
+   *  their own internal scratch space.
+   *
+   *  @param npts : Number of points
+   *  @param inputs : Array of independent variable arrays
+   *  @param result : The property at each point
+   *  @param ws : Scratch space; also accumulates the clipping events
+   */
+  void query( const size_t npts,
+              const double * const * inputs,
+              double * result,
+              HDF5TableWorkspace & ws ) const;
+
+  /** True if batched queries use the dense tensor form of the spline */
+  bool has_tensor_form() const { return NULL != splineTensor_; }
+
+  /** Fold the clipping events gathered by batched queries into this table
+   *  and reset them in the workspace */
+  void merge_clipping( HDF5TableWorkspace & ws );
+
   /** Set the number of clipping events we want to log */
   void set_clipping_log_size( unsigned int size ) ;
 
@@ -154,6 +197,7 @@ class HDF5Table
 
   // Add the current values to the clipping event log
   void log_clip_event( const std::vector<double> & values ) const;
+  void log_clip_event( const std::vector<double> & values, ClipEventLog & log ) const;
 
   /** Rewire the inputs and outputs of the Table and any optional Converters
    *  so that they talk to each other properly and inputs to the HDF5Table will
@@ -228,6 +272,9 @@ class HDF5Table
   // Internal interpolator used to perform table lookups
   BSpline * spline_;
 
+  // Dense form of spline_ used by the batched query; null if unavailable
+  BSplineTensor * splineTensor_;
+
   // Buffers for storing clipping diagnostic information
   mutable unsigned int clipEventLogSize_;
   mutable unsigned int numClipped_;
@@ -0,0 +1,42 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef LibraryIOLock_h
+#define LibraryIOLock_h
+
+#include <mutex>
+
+namespace sierra {
+namespace nalu {
+
+/** Process-wide lock around calls into the Ioss/Exodus/NetCDF and HDF5
+ *  libraries
+ *
+ *  None of these libraries is thread safe. The background output writer,
+ *  the input prefetch reader and the solver thread each hold the lock for
+ *  a sequence of library calls that may run while a background thread is
+ *  active, so that at most one thread is inside the libraries at a time.
+ *  H5IO takes it in every call, hence it is recursive.
+ *
+ *  The output writer thread may communicate, on its own duplicate of the
+ *  mesh communicator, while it holds the lock. A solver thread waiting for
+ *  the lock inside collective io could then wait on a rank whose writer
+ *  waits on this rank, so solver-side io that may be collective calls
+ *  Realm::wait_for_output() before taking the lock. The
+ *  input prefetch thread reads per-rank files and makes no MPI calls.
+ */
+std::recursive_mutex& library_io_mutex();
+
+typedef std::lock_guard<std::recursive_mutex> LibraryIOGuard;
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -89,6 +89,18 @@ void compute_precise_ghosting_lists(
   stk::mesh::EntityProcVec& curSendGhosts,
   std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
 
+/** Ask the owners of received ghosts to keep sending them
+ *
+ *  Each receiving rank sends the keys of the ghosted elements it still
+ *  requires to their owners, which append (element, requesting rank) to
+ *  elemsToGhost. Used when a rank resolves dependencies locally, i.e.,
+ *  without the owner observing them through a coarse search.
+ */
+void communicate_recv_ghosts_to_keep(
+  const stk::mesh::BulkData& bulk,
+  const std::vector<stk::mesh::Entity>& recvGhostsToKeep,
+  stk::mesh::EntityProcVec& elemsToGhost);
+
 /** Return a field ordinal given the name of the field
  */
 inline
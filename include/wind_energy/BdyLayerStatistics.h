@@ -17,6 +17,8 @@
 
 #include "stk_mesh/base/Part.hpp"
 
+#include <mpi.h>
+
 #include <memory>
 
 namespace sierra {
@@ -61,6 +63,18 @@ public:
    */
   void execute();
 
+  /** Accumulate the local sums and start their global reduction
+   *
+   *  All per-height sums are packed in one buffer and reduced with a single
+   *  non-blocking collective. Work that neither reads the statistics nor
+   *  changes the fields they sample may proceed until end_execute().
+   */
+  void begin_execute();
+
+  /** Complete the reduction, form the averages and output them
+   */
+  void end_execute();
+
   /** Return the spatial average of the instantaneous velocity field at a given height
    *
    *  The method interpolates the spatially averaged velocity from available
@@ -103,10 +117,10 @@ public:
   //!
   int abl_height_index(const double) const;
 
-  //! Process the velocity data and compute averages
+  //! Accumulate the local velocity sums at each height
   void impl_compute_velocity_stats();
 
-  //! Process the temperature field and compute averages
+  //! Accumulate the local temperature sums at each height
   void impl_compute_temperature_stats();
 
 private:
@@ -119,6 +133,12 @@ private:
   //! Initialize necessary parameters in sierra::nalu::TurbulenceAveragingPostProcessing
   void setup_turbulence_averaging(const double);
 
+  //! Normalize the reduced velocity sums and form the fluctuations
+  void average_velocity_stats();
+
+  //! Normalize the reduced temperature sums and form the fluctuations
+  void average_temperature_stats();
+
   //! Output averaged velocity and stress profiles as a function of height
   void output_velocity_averages();
 
@@ -148,6 +168,10 @@ private:
   //! Reference to Realm object
   Realm& realm_;
 
+  //! Contiguous storage of all the per-height sums; the arrays below are views into it
+  ArrayType d_packedSums_;
+  HostArrayType packedSums_;
+
   //! Spatially averaged instantaneous velocity at desired heights [nHeights, nDim]
   ArrayType d_velAvg_;
 
@@ -288,6 +312,10 @@ private:
 
   //! Flag indicating whether initialization must be performed
   bool doInit_{true};
+
+  //! Pending reduction of the packed sums
+  MPI_Request reductionRequest_{MPI_REQUEST_NULL};
+  bool reductionInFlight_{false};
 };
 
 }  // nalu
@@ -51,6 +51,10 @@ public :
   static void apply (MeshB         &ToPoints,
       const MeshA         &FromElem,
       const EntityKeyMap &RangeToDomain) ;
+
+  static void build_stencils (MeshB         &ToPoints,
+      const MeshA         &FromElem,
+      const EntityKeyMap &RangeToDomain) ;
 };
 
 template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
@@ -61,6 +65,9 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData &toBulkData = ToPoints.toBulkData_;
 
+  // new search; the weights are rebuilt by the next apply
+  ToPoints.stencilValid_ = false;
+
   const VectorFieldType *fromcoordinates = FromElem.fromcoordinates_;
   const VectorFieldType *tocoordinates   = ToPoints.tocoordinates_;
 
@@ -147,29 +154,35 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   NaluEnv::self().naluOutputP0() << "  Should max normalized distance and/or candidate bounding box size be too large, please check setup" << std::endl;
  }
 
-template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+template <class FROM, class TO>  void LinInterp<FROM,TO>::build_stencils
        (MeshB              &ToPoints,
         const MeshA        &FromElem,
         const EntityKeyMap &RangeToDomain) {
-  
+
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
- 
+
+  ToPoints.stencilToNodes_.clear();
+  ToPoints.stencilOffsets_.assign(1, 0);
+  ToPoints.stencilFromNodes_.clear();
+  ToPoints.stencilWeights_.clear();
+
+  std::vector<double> unitValues;
   typename EntityKeyMap::const_iterator ii;
-  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
-    
+  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) {
+
     const stk::mesh::EntityKey thePt  = ii->first;
-    const stk::mesh::EntityKey theBox = ii->second; 
-    
+    const stk::mesh::EntityKey theBox = ii->second;
+
     if (1 != ToPoints.TransferInfo_.count(thePt)) {
-      if (0 == ToPoints.TransferInfo_.count(thePt)) 
+      if (0 == ToPoints.TransferInfo_.count(thePt))
         throw std::runtime_error("Key not found in database");
-      else  
+      else
         throw std::runtime_error("Too many Keys found in database");
     }
     const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
     stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
-    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
+    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);
 
     const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
     const stk::topology &theElemTopo = theBucket.topology();
@@ -179,35 +192,65 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
     const int num_nodes = fromBulkData.num_nodes(theElem);
     const int nodesPerElement = meSCS->nodesPerElement_;
 
-    for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
+    // the interpolant is linear in the nodal values; the weight of a node is
+    // the interpolant of its unit vector
+    unitValues.assign(nodesPerElement, 0.0);
+    for ( int ni = 0; ni < num_nodes; ++ni ) {
+      double weight = 0.0;
+      unitValues[ni] = 1.0;
+      meSCS->interpolatePoint(1, &isoParCoords_[0], &unitValues[0], &weight);
+      unitValues[ni] = 0.0;
+
+      ToPoints.stencilFromNodes_.push_back(elem_node_rels[ni]);
+      ToPoints.stencilWeights_.push_back(weight);
+    }
+    ToPoints.stencilToNodes_.push_back(theNode);
+    ToPoints.stencilOffsets_.push_back(ToPoints.stencilFromNodes_.size());
+  }
+  ToPoints.stencilValid_ = true;
+  ToPoints.stencilSyncCounts_ = std::make_pair(
+    fromBulkData.synchronized_count(), toBulkData.synchronized_count());
+}
 
-      // extract field
-      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
+       (MeshB              &ToPoints,
+        const MeshA        &FromElem,
+        const EntityKeyMap &RangeToDomain) {
+  
+  // the search result only changes with a new search; interpolate with the
+  // weights found for the first execution unless entities have moved since
+  if ( !ToPoints.stencilValid_
+       || ToPoints.stencilSyncCounts_.first != FromElem.fromBulkData_.synchronized_count()
+       || ToPoints.stencilSyncCounts_.second != ToPoints.toBulkData_.synchronized_count() )
+    build_stencils(ToPoints, FromElem, RangeToDomain);
 
-      // FixMe: integers are problematic for now...
-      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
+  const size_t numStencils = ToPoints.stencilToNodes_.size();
 
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
+  for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
 
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
+    // extract field
+    const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
+    const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
 
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
+    for ( size_t k = 0; k < numStencils; ++k ) {
+      stk::mesh::Entity theNode = ToPoints.stencilToNodes_[k];
+
+      // FixMe: integers are problematic for now...
+      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
 
       double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
       if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
-    }   
+
+      for ( size_t j = 0; j < sizeOfField; ++j )
+        toField[j] = 0.0;
+
+      for ( size_t s = ToPoints.stencilOffsets_[k]; s < ToPoints.stencilOffsets_[k+1]; ++s ) {
+        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, ToPoints.stencilFromNodes_[s]);
+        const double weight = ToPoints.stencilWeights_[s];
+        for ( size_t j = 0; j < sizeOfField; ++j )
+          toField[j] += weight*theField[j];
+      }
+    }
   }
 }
 
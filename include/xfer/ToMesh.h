@@ -199,6 +199,14 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // interpolation weights of the last search in compressed rows: the target
+  // node k interpolates from stencilFromNodes_[stencilOffsets_[k]...]
+  bool stencilValid_{false};
+  std::pair<size_t, size_t> stencilSyncCounts_{0, 0};
+  std::vector<stk::mesh::Entity> stencilToNodes_;
+  std::vector<size_t> stencilOffsets_;
+  std::vector<stk::mesh::Entity> stencilFromNodes_;
+  std::vector<double> stencilWeights_;
 };
 
 } // namespace nalu